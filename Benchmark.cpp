@@ -0,0 +1,659 @@
+#include "EnumInfo.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+
+// Counts heap allocations to report allocations per operation.
+// Not inlined, GCC warns about free() of memory from new otherwise.
+static size_t allocationCount = 0;
+
+BENCHMARK_NOINLINE void* operator new(size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+BENCHMARK_NOINLINE void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+BENCHMARK_NOINLINE void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+
+ENUM_DECLARE_NS( CardSuit, int8_t,
+    Spades,
+    Hearts,
+    Diamonds,
+    Clubs
+)
+
+class SomeClass
+{
+public:
+    ENUM_DECLARE( TasteFlags, uint64_t,
+        None      = 0,
+        Salted    = 1 << 0,
+        Sour      = 1 << 1,
+        Sweet     = 1 << 2,
+        SourSweet = (Sour | Sweet)
+    )
+};
+
+namespace SomeNamespace
+{
+    ENUM_DECLARE_NS( Ports, int,
+        HTTP  = 80,
+        HTTPS = 443,
+        SecureShell = 22,
+        SSH   = 22
+    )
+}
+
+#define BENCHMARK_ENUM_4(prefix)    prefix##0, prefix##1, prefix##2, prefix##3
+#define BENCHMARK_ENUM_16(prefix)   BENCHMARK_ENUM_4(prefix##0), BENCHMARK_ENUM_4(prefix##1), \
+                                    BENCHMARK_ENUM_4(prefix##2), BENCHMARK_ENUM_4(prefix##3)
+#define BENCHMARK_ENUM_64(prefix)   BENCHMARK_ENUM_16(prefix##0), BENCHMARK_ENUM_16(prefix##1), \
+                                    BENCHMARK_ENUM_16(prefix##2), BENCHMARK_ENUM_16(prefix##3)
+#define BENCHMARK_ENUM_256(prefix)  BENCHMARK_ENUM_64(prefix##0), BENCHMARK_ENUM_64(prefix##1), \
+                                    BENCHMARK_ENUM_64(prefix##2), BENCHMARK_ENUM_64(prefix##3)
+#define BENCHMARK_ENUM_1024(prefix) BENCHMARK_ENUM_256(prefix##0), BENCHMARK_ENUM_256(prefix##1), \
+                                    BENCHMARK_ENUM_256(prefix##2), BENCHMARK_ENUM_256(prefix##3)
+#define BENCHMARK_ENUM_4096(prefix) BENCHMARK_ENUM_1024(prefix##0), BENCHMARK_ENUM_1024(prefix##1), \
+                                    BENCHMARK_ENUM_1024(prefix##2), BENCHMARK_ENUM_1024(prefix##3)
+
+ENUM_DECLARE_NS( Enum16, int, BENCHMARK_ENUM_16(Value) )
+ENUM_DECLARE_NS( Enum64, int, BENCHMARK_ENUM_64(Value) )
+ENUM_DECLARE_NS( Enum256, int, BENCHMARK_ENUM_256(Value) )
+ENUM_DECLARE_NS( Enum1024, int, BENCHMARK_ENUM_1024(Value) )
+ENUM_DECLARE_NS( Enum4096, int, BENCHMARK_ENUM_4096(Value) )
+
+/// Keeps the compiler from optimizing away a benchmarked result
+template<typename T>
+void doNotOptimize(const T& value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    // No inline asm on MSVC x64: publish the address through a volatile and fence the compiler
+    const volatile char* volatile address = &reinterpret_cast<const volatile char&>(value);
+    static_cast<void>(address);
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/**
+ * Runs @p func for each element of @p inputs until @p iterations calls are made
+ * and prints time and heap allocations per call
+ */
+template<typename Input, typename F>
+void benchmark(std::string_view benchmarkName, const std::vector<Input>& inputs, size_t iterations, F func)
+{
+    const size_t allocationsBefore = allocationCount;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0, input = 0; i < iterations; ++i)
+    {
+        doNotOptimize(func(inputs[input]));
+        input = input + 1 == inputs.size() ? 0 : input + 1;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const size_t allocations = allocationCount - allocationsBefore;
+
+    const double nsPerOp = double(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / double(iterations);
+    std::cout << std::left << std::setw(48) << benchmarkName
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2) << nsPerOp << " ns/op"
+              << std::setw(10) << double(allocations) / double(iterations) << " allocs/op" << std::endl;
+}
+
+/// Runs @p func once over @p count items and prints items per second
+template<typename F>
+void benchmarkThroughput(std::string_view benchmarkName, size_t count, F func)
+{
+    const size_t allocationsBefore = allocationCount;
+    const auto start = std::chrono::steady_clock::now();
+    doNotOptimize(func());
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const size_t allocations = allocationCount - allocationsBefore;
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    std::cout << std::left << std::setw(48) << benchmarkName
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2) << double(count) / seconds / 1e6 << " M items/s"
+              << std::setw(10) << double(allocations) / double(count) << " allocs/item" << std::endl;
+}
+
+template<typename Enum>
+std::vector<Enum> enumValues()
+{
+    std::vector<Enum> values;
+    for (auto it: EnumInfo<Enum>())
+    {
+        values.push_back(it.value());
+    }
+    return values;
+}
+
+template<typename Enum>
+std::vector<std::string> enumValueNames()
+{
+    std::vector<std::string> names;
+    for (auto it: EnumInfo<Enum>())
+    {
+        names.emplace_back(it.name());
+    }
+    return names;
+}
+
+template<typename Enum>
+void benchmarkLookup(std::string_view enumName, size_t iterations)
+{
+    const auto values = enumValues<Enum>();
+    const auto names = enumValueNames<Enum>();
+    std::vector<size_t> indexes;
+    for (size_t i = 0; i < EnumInfo<Enum>::size(); ++i)
+    {
+        indexes.push_back(i);
+    }
+
+    std::cout << "--- " << enumName << " (" << EnumInfo<Enum>::size() << " entries, "
+              << EnumInfo<Enum>::dataSize() << " bytes of reflection data) ---" << std::endl;
+    benchmark("valueName(Enum)", values, iterations, [](Enum value)
+    {
+        return EnumInfo<Enum>::valueName(value);
+    });
+    benchmark("valueName(size_t)", indexes, iterations, [](size_t index)
+    {
+        return EnumInfo<Enum>::valueName(index);
+    });
+    benchmark("value(String)", names, iterations, [](const std::string& name)
+    {
+        return EnumInfo<Enum>::value(name);
+    });
+    benchmark("index(Enum)", values, iterations, [](Enum value)
+    {
+        return EnumInfo<Enum>::index(value);
+    });
+    benchmark("index(String)", names, iterations, [](const std::string& name)
+    {
+        return EnumInfo<Enum>::index(name);
+    });
+    benchmark("valueNames(Enum) with aliases", values, iterations, [](Enum value)
+    {
+        size_t length = 0;
+        for (const auto name: EnumInfo<Enum>::valueNames(value))
+        {
+            length += name.size();
+        }
+        return length;
+    });
+    benchmark("valueName(Enum) with String = std::string", values, iterations, [](Enum value)
+    {
+        return EnumInfo<Enum, std::string>::valueName(value).has_value();
+    });
+    benchmark("value(String) with String = std::string", names, iterations, [](const std::string& name)
+    {
+        return EnumInfo<Enum, std::string>::value(name);
+    });
+    const std::vector<int> pass = {0};
+    benchmark("iteration over all entries", pass, std::max<size_t>(iterations / EnumInfo<Enum>::size(), 1), [](int)
+    {
+        size_t length = 0;
+        for (auto it: EnumInfo<Enum>())
+        {
+            length += it.name().size() + size_t(it.value());
+        }
+        return length;
+    });
+}
+
+/**
+ * Compares EnumInfo::value(String) with std::unordered_map and linear search over names.
+ * Build with -DENUM_INFO_SMALL_NAME_INDEX_MAX_SIZE=0 to measure the perfect hash on small enums.
+ */
+template<typename Enum>
+void benchmarkNameLookup(std::string_view enumName, size_t iterations)
+{
+    const auto names = enumValueNames<Enum>();
+
+    std::unordered_map<std::string_view, Enum> valByName;
+    for (auto it: EnumInfo<Enum>())
+    {
+        valByName.emplace(it.name(), it.value());
+    }
+
+    const bool isSmallNameIndex = EnumInfo<Enum>::size() <= ENUM_INFO_SMALL_NAME_INDEX_MAX_SIZE;
+    std::cout << "--- " << enumName << " name lookup (" << EnumInfo<Enum>::size() << " entries) ---" << std::endl;
+    benchmark(isSmallNameIndex ? "SIMD small name index" : "perfect hash", names, iterations, [](const std::string& name)
+    {
+        return EnumInfo<Enum>::value(name);
+    });
+    benchmark("std::unordered_map", names, iterations, [&valByName](const std::string& name)
+    {
+        const auto it = valByName.find(name);
+        return it != valByName.end() ? std::optional<Enum>(it->second) : std::nullopt;
+    });
+    benchmark("linear", names, iterations, [](const std::string& name)
+    {
+        for (auto it: EnumInfo<Enum>())
+        {
+            if (it.name() == name)
+                return std::optional<Enum>(it.value());
+        }
+        return std::optional<Enum>();
+    });
+}
+
+/// Compares EnumInfo::valueCaseInsensitive with lowercasing into a temporary for std::unordered_map
+template<typename Enum>
+void benchmarkCaseInsensitiveLookup(std::string_view enumName, size_t iterations)
+{
+    const auto toLower = [](std::string_view name)
+    {
+        std::string lower(name);
+        std::transform(lower.begin(), lower.end(), lower.begin(), [](char c)
+        {
+            return IgnoreCase::fold(c);
+        });
+        return lower;
+    };
+
+    std::vector<std::string> names;
+    std::unordered_map<std::string, Enum> valByLowerName;
+    for (auto it: EnumInfo<Enum>())
+    {
+        names.push_back(toLower(it.name()));
+        names.back()[0] = char(names.back()[0] - 'a' + 'A');
+        valByLowerName.emplace(toLower(it.name()), it.value());
+    }
+
+    std::cout << "--- " << enumName << " case insensitive name lookup (" << EnumInfo<Enum>::size() << " entries) ---" << std::endl;
+    benchmark("valueCaseInsensitive", names, iterations, [](const std::string& name)
+    {
+        return EnumInfo<Enum>::valueCaseInsensitive(name);
+    });
+    benchmark("value(name, IgnoreCaseAndSeparators)", names, iterations, [](const std::string& name)
+    {
+        return EnumInfo<Enum>::value(name, IgnoreCaseAndSeparators());
+    });
+    benchmark("lowercase copy and std::unordered_map", names, iterations, [&valByLowerName, &toLower](const std::string& name)
+    {
+        const auto it = valByLowerName.find(toLower(name));
+        return it != valByLowerName.end() ? std::optional<Enum>(it->second) : std::nullopt;
+    });
+}
+
+template<typename Enum>
+void benchmarkFormat(std::string_view enumName, size_t iterations)
+{
+    const auto values = enumValues<Enum>();
+
+    std::cout << "--- " << enumName << " format ---" << std::endl;
+    benchmark("writeName to buffer", values, iterations, [](Enum value)
+    {
+        char buffer[32];
+        return EnumInfo<Enum>::writeName(value, buffer, sizeof(buffer));
+    });
+    std::ostringstream stream;
+    benchmark("valueName().value_or() to std::ostream", values, iterations, [&stream](Enum value)
+    {
+        stream.seekp(0);
+        stream << EnumInfo<Enum>::valueName(value).value_or("ERROR");
+        return stream.tellp();
+    });
+}
+
+template<typename Enum>
+void benchmarkBatch(std::string_view enumName, size_t count)
+{
+    const auto enumerators = enumValues<Enum>();
+    std::vector<Enum> values(count);
+    std::vector<std::string_view> names(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        values[i] = enumerators[(i * 7) % enumerators.size()];
+        names[i] = EnumInfo<Enum>::valueName(values[i]).value();
+    }
+    std::vector<Enum> parsedValues(count);
+    std::vector<uint64_t> errorMask((count + 63) / 64);
+    std::vector<typename EnumInfo<Enum>::Code> codes(count);
+    std::vector<typename EnumInfo<Enum>::EnumType> received(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        received[i] = static_cast<typename EnumInfo<Enum>::EnumType>(values[i]);
+    }
+
+    std::cout << "--- " << enumName << " batch of " << count << " ---" << std::endl;
+    benchmarkThroughput("valueNames(values, count, names)", count, [&]
+    {
+        return EnumInfo<Enum>::valueNames(values.data(), count, names.data());
+    });
+    benchmarkThroughput("valueName(Enum) per element", count, [&]
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            names[i] = EnumInfo<Enum>::valueName(values[i]).value_or("");
+        }
+        return names.back();
+    });
+    benchmarkThroughput("values(names, count, values, errorMask)", count, [&]
+    {
+        return EnumInfo<Enum>::values(names.data(), count, parsedValues.data(), errorMask.data());
+    });
+    benchmarkThroughput("value(String) per element", count, [&]
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            parsedValues[i] = EnumInfo<Enum>::value(names[i]).value_or(Enum());
+        }
+        return parsedValues.back();
+    });
+    benchmarkThroughput("encode(values, count, codes, errorMask)", count, [&]
+    {
+        return EnumInfo<Enum>::encode(values.data(), count, codes.data(), errorMask.data());
+    });
+    benchmarkThroughput("decode(codes, count, values, errorMask)", count, [&]
+    {
+        return EnumInfo<Enum>::decode(codes.data(), count, parsedValues.data(), errorMask.data());
+    });
+    benchmarkThroughput("validate(values, count, errorMask)", count, [&]
+    {
+        return EnumInfo<Enum>::validate(received.data(), count, errorMask.data());
+    });
+    benchmarkThroughput("index(Enum) per element", count, [&]
+    {
+        size_t invalid = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            invalid += !EnumInfo<Enum>::index(static_cast<Enum>(received[i])).has_value();
+        }
+        return invalid;
+    });
+}
+
+/// EnumMap and EnumSet against the std containers they replace
+template<typename Enum>
+void benchmarkContainers(std::string_view enumName, size_t iterations)
+{
+    const auto values = enumValues<Enum>();
+    EnumMap<Enum, size_t> enumMap;
+    std::unordered_map<Enum, size_t> unorderedMap;
+    EnumSet<Enum> enumSet;
+    std::set<Enum> set;
+    for (size_t i = 0; i < values.size(); i += 2)
+    {
+        enumMap[values[i]] = i;
+        unorderedMap[values[i]] = i;
+        enumSet.insert(values[i]);
+        set.insert(values[i]);
+    }
+
+    std::cout << "--- " << enumName << " containers ---" << std::endl;
+    benchmark("EnumMap::operator[]", values, iterations, [&enumMap](Enum value)
+    {
+        return ++enumMap[value];
+    });
+    benchmark("std::unordered_map::operator[]", values, iterations, [&unorderedMap](Enum value)
+    {
+        return ++unorderedMap[value];
+    });
+    benchmark("EnumSet::contains", values, iterations, [&enumSet](Enum value)
+    {
+        return enumSet.contains(value);
+    });
+    benchmark("std::set::count", values, iterations, [&set](Enum value)
+    {
+        return set.count(value);
+    });
+
+    const EnumSet<Enum> odd = EnumSet<Enum>::all() - enumSet;
+    std::set<Enum> oddSet;
+    std::set_difference(values.begin(), values.end(), set.begin(), set.end(), std::inserter(oddSet, oddSet.end()));
+    const std::vector<int> pass = {0};
+    benchmark("EnumSet union and size", pass, iterations / 10, [&](int)
+    {
+        return (enumSet | odd).size();
+    });
+    benchmark("std::set_union and size", pass, iterations / 100, [&](int)
+    {
+        std::vector<Enum> united;
+        std::set_union(set.begin(), set.end(), oddSet.begin(), oddSet.end(), std::back_inserter(united));
+        return united.size();
+    });
+}
+
+/// Dispatch of a value to its handler by EnumInfo::visit against a map of std::function
+template<typename Enum>
+void benchmarkVisit(std::string_view enumName, size_t iterations)
+{
+    using Underlying = std::underlying_type_t<Enum>;
+    const auto values = enumValues<Enum>();
+    std::map<Enum, std::function<size_t(size_t)>> handlers;
+    for (const auto value: values)
+    {
+        handlers[value] = [value](size_t argument) { return argument * 3 + size_t(Underlying(value)); };
+    }
+
+    std::cout << "--- " << enumName << " dispatch ---" << std::endl;
+    benchmark("visit(Enum, handler)", values, iterations, [](Enum value)
+    {
+        return EnumInfo<Enum>::visit(value, [](auto constant) { return size_t(7) * 3 + size_t(Underlying(constant.value)); });
+    });
+    benchmark("std::map<Enum, std::function>", values, iterations, [&handlers](Enum value)
+    {
+        const auto handler = handlers.find(value);
+        return handler != handlers.end() ? handler->second(7) : 0;
+    });
+}
+
+/// Log-like text of about @p size bytes where every fifth word is a name of @p Enum
+template<typename Enum>
+std::string logText(size_t size)
+{
+    const auto names = enumValueNames<Enum>();
+    const std::string_view words[] = {"request", "worker_17", "failed:", "timeout", "retry=3", "12:00:00", "user", "ok"};
+    std::string text;
+    text.reserve(size + 64);
+    for (size_t i = 0; text.size() < size; ++i)
+    {
+        text += i % 5 == 4 ? std::string_view(names[(i / 5) % names.size()]) : words[(i * 7) % std::size(words)];
+        text += i % 16 == 15 ? '\n' : ' ';
+    }
+    return text;
+}
+
+/// Counts names in a text by EnumNameScanner against std::string_view::find for each name
+template<typename Enum>
+void benchmarkScanner(std::string_view enumName, size_t size)
+{
+    const std::string text = logText<Enum>(size);
+    const auto names = enumValueNames<Enum>();
+    EnumMap<Enum, size_t> counts;
+
+    std::cout << "--- " << enumName << " names in " << text.size() / 1'000'000 << " MB of text, items are bytes ---" << std::endl;
+    benchmarkThroughput("scanner().count in one chunk", text.size(), [&]
+    {
+        auto scanner = EnumInfo<Enum>::scanner();
+        scanner.count(text, counts);
+        scanner.finish(counts);
+        return counts[*EnumInfo<Enum>::value(size_t(0))];
+    });
+    benchmarkThroughput("scanner().count in 4 KB chunks", text.size(), [&]
+    {
+        auto scanner = EnumInfo<Enum>::scanner();
+        for (size_t offset = 0; offset < text.size(); offset += 4096)
+        {
+            scanner.count(std::string_view(text).substr(offset, 4096), counts);
+        }
+        scanner.finish(counts);
+        return counts[*EnumInfo<Enum>::value(size_t(0))];
+    });
+    if (names.size() <= 16)
+    {
+        benchmarkThroughput("std::string_view::find for each name", text.size(), [&]
+        {
+            const auto isIdentChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+            const std::string_view view = text;
+            size_t found = 0;
+            for (const auto& name: names)
+            {
+                for (size_t pos = view.find(name); pos != std::string_view::npos; pos = view.find(name, pos + 1))
+                {
+                    const size_t end = pos + name.size();
+                    found += (pos == 0 || !isIdentChar(view[pos - 1])) && (end == view.size() || !isIdentChar(view[end]));
+                }
+            }
+            return found;
+        });
+    }
+}
+
+/// Names split in two fragments, parsed by EnumInfo::Parser against copying them together for value()
+template<typename Enum>
+void benchmarkParser(std::string_view enumName, size_t iterations)
+{
+    const auto names = enumValueNames<Enum>();
+    std::vector<std::string> texts;
+    for (const auto& name: names)
+    {
+        texts.push_back(name + " ");
+    }
+    std::vector<std::pair<std::string_view, std::string_view>> fragments;
+    for (const auto& text: texts)
+    {
+        const size_t split = (text.size() - 1) / 2;
+        fragments.emplace_back(std::string_view(text).substr(0, split), std::string_view(text).substr(split));
+    }
+    std::string buffer;
+
+    std::cout << "--- " << enumName << " name in two fragments ---" << std::endl;
+    benchmark("Parser", fragments, iterations, [](std::pair<std::string_view, std::string_view> fragment)
+    {
+        typename EnumInfo<Enum>::Parser parser;
+        parser.parse(fragment.first);
+        parser.parse(fragment.second);
+        return parser.value();
+    });
+    benchmark("copy to std::string and value(String)", fragments, iterations, [&buffer](std::pair<std::string_view, std::string_view> fragment)
+    {
+        buffer.assign(fragment.first);
+        buffer.append(fragment.second.substr(0, fragment.second.find(' ')));
+        return EnumInfo<Enum>::value(buffer);
+    });
+}
+
+void benchmarkFlags(size_t iterations)
+{
+    using Taste = SomeClass::TasteFlags;
+    const std::vector<Taste> values = {Taste::Salted, Taste(Taste::Salted | Taste::Sweet), Taste(Taste::Salted | Taste::SourSweet)};
+    std::vector<std::string> names;
+    for (const auto value: values)
+    {
+        names.push_back(FlagInfo<Taste>::toString(value).value());
+    }
+
+    std::cout << "--- TasteFlags flags ---" << std::endl;
+    benchmark("FlagInfo::format to buffer", values, iterations, [](Taste value)
+    {
+        char buffer[64];
+        return FlagInfo<Taste>::format(value, buffer, sizeof(buffer));
+    });
+    benchmark("FlagInfo::toString", values, iterations, [](Taste value)
+    {
+        return FlagInfo<Taste>::toString(value).has_value();
+    });
+    benchmark("FlagInfo::parse", names, iterations, [](const std::string& name)
+    {
+        return FlagInfo<Taste>::parse(name);
+    });
+}
+#if ENUM_INFO_REGISTRY
+/// Type-erased lookup through EnumRegistry, the enum is resolved on every call
+template<typename Enum>
+void benchmarkRegistry(size_t iterations)
+{
+    const auto names = enumValueNames<Enum>();
+
+    std::cout << "--- EnumRegistry (" << EnumRegistry::size() << " enums) ---" << std::endl;
+    benchmark("lookupValue(qualifiedName, valueName)", names, iterations, [](const std::string& name)
+    {
+        return EnumRegistry::lookupValue(EnumInfo<Enum>::qualifiedName(), name);
+    });
+    benchmark("lookupValue(typeHash, valueName)", names, iterations, [](const std::string& name)
+    {
+        return EnumRegistry::lookupValue(EnumInfo<Enum>::typeHash(), name);
+    });
+}
+#endif
+
+
+int main()
+{
+    constexpr size_t iterations = 10'000'000;
+
+    benchmarkLookup<CardSuit>("CardSuit", iterations);
+    benchmarkLookup<SomeNamespace::Ports>("Ports", iterations);
+    benchmarkLookup<Enum256>("Enum256", iterations);
+    benchmarkLookup<Enum4096>("Enum4096", iterations);
+
+    benchmarkNameLookup<CardSuit>("CardSuit", iterations);
+    benchmarkNameLookup<Enum16>("Enum16", iterations);
+    benchmarkNameLookup<Enum64>("Enum64", iterations);
+    benchmarkNameLookup<Enum1024>("Enum1024", iterations / 10);
+
+    benchmarkCaseInsensitiveLookup<SomeNamespace::Ports>("Ports", iterations);
+    benchmarkCaseInsensitiveLookup<Enum1024>("Enum1024", iterations / 10);
+
+    benchmarkFormat<SomeNamespace::Ports>("Ports", iterations);
+    benchmarkFlags(iterations);
+
+    constexpr size_t batchSize = 10'000'000;
+    benchmarkBatch<CardSuit>("CardSuit", batchSize);
+    benchmarkBatch<SomeNamespace::Ports>("Ports", batchSize);
+    benchmarkBatch<Enum64>("Enum64", batchSize);
+
+    benchmarkContainers<CardSuit>("CardSuit", iterations);
+    benchmarkContainers<Enum256>("Enum256", iterations);
+
+    benchmarkVisit<CardSuit>("CardSuit", iterations);
+    benchmarkVisit<SomeNamespace::Ports>("Ports", iterations);
+    benchmarkVisit<Enum64>("Enum64", iterations);
+
+    benchmarkParser<SomeNamespace::Ports>("Ports", iterations);
+    benchmarkParser<Enum256>("Enum256", iterations);
+
+    constexpr size_t textSize = 64'000'000;
+    benchmarkScanner<SomeNamespace::Ports>("Ports", textSize);
+    benchmarkScanner<Enum256>("Enum256", textSize);
+
+#if ENUM_INFO_REGISTRY
+    benchmarkRegistry<SomeNamespace::Ports>(iterations);
+#endif
+
+#if ENUM_INFO_STATS
+    std::cout << "--- Lookup statistics ---" << std::endl;
+    EnumLookupStats::dump(std::cout);
+#endif
+}
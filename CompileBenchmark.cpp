@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+
+// Set by CMakeLists.txt
+#ifndef ENUM_INFO_COMPILER
+#define ENUM_INFO_COMPILER "c++"
+#endif
+#ifndef ENUM_INFO_SOURCE_DIR
+#define ENUM_INFO_SOURCE_DIR "."
+#endif
+#ifndef ENUM_INFO_COMPILE_FLAGS
+#define ENUM_INFO_COMPILE_FLAGS "-std=c++17 -O2"
+#endif
+
+/// Compile time and object file size of a translation unit, negative seconds if compilation fails
+struct CompileResult
+{
+    double seconds;
+    std::uintmax_t objectBytes;
+};
+
+/// Best of three compilations, the compiler is too noisy to compare single runs
+CompileResult compile(const std::string& source, const std::string& flags = {})
+{
+    const std::string path = "EnumInfoCompileBenchmark.cpp";
+    const std::string objectPath = "EnumInfoCompileBenchmark.o";
+    std::ofstream(path) << source;
+
+    const std::string command = std::string(ENUM_INFO_COMPILER) + " " ENUM_INFO_COMPILE_FLAGS " -I \"" ENUM_INFO_SOURCE_DIR "\" " + flags
+                                + " -c " + path + " -o " + objectPath;
+    CompileResult best{-1.0, 0};
+    for (int run = 0; run < 3; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const int result = std::system(command.c_str());
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        if (result != 0)
+        {
+            best = {-1.0, 0};
+            break;
+        }
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        if (best.seconds < 0 || seconds < best.seconds)
+            best.seconds = seconds;
+        std::error_code error;
+        best.objectBytes = std::filesystem::file_size(objectPath, error);
+    }
+
+    std::error_code error;
+    std::filesystem::remove(path, error);
+    std::filesystem::remove(objectPath, error);
+    return best;
+}
+
+void report(std::string_view benchmarkName, CompileResult compiled, const CompileResult& baseline)
+{
+    std::cout << std::left << std::setw(48) << benchmarkName << std::right << std::fixed << std::setprecision(2);
+    if (compiled.seconds < 0)
+    {
+        std::cout << std::setw(10) << "failed" << std::endl;
+        return;
+    }
+    // Signed, an object file may be smaller than the baseline
+    const auto extraBytes = static_cast<std::intmax_t>(compiled.objectBytes) - static_cast<std::intmax_t>(baseline.objectBytes);
+    std::cout << std::setw(10) << compiled.seconds - baseline.seconds << " s"
+              << std::setw(10) << extraBytes << " bytes of .o over baseline" << std::endl;
+}
+
+/// Translation unit declaring an enum of @p size entries by ENUM_DECLARE_NS, every tenth with an initializer
+std::string declareSource(size_t size)
+{
+    std::string source = "#include \"EnumInfo.h\"\nENUM_DECLARE_NS( Generated, int32_t";
+    for (size_t i = 0; i < size; ++i)
+    {
+        source += ",\n    Value" + std::to_string(i);
+        if (i % 10 == 5)
+            source += " = " + std::to_string(i * 3);
+    }
+    source += "\n)\n"
+              "int main(int argc, char** argv)\n"
+              "{\n"
+              "    return EnumInfo<Generated>::valueName(static_cast<Generated>(argc)).has_value()\n"
+              "           && EnumInfo<Generated>::value(argv[0]).has_value();\n"
+              "}\n";
+    return source;
+}
+
+/// Translation unit reflecting an enum of 8 enumerators without ENUM_DECLARE by scanning @p rangeSize values
+std::string scanSource(long rangeSize)
+{
+    std::string source = "#define ENUM_INFO_SCAN 1\n"
+                         "#include \"EnumInfo.h\"\n"
+                         "enum class Plain : int32_t { A0, A1, A2, A3, A4, A5, A6, A7 };\n";
+    source += "template<> struct EnumScanRange<Plain> { static constexpr int64_t min = " + std::to_string(-rangeSize / 2)
+              + "; static constexpr int64_t max = " + std::to_string(rangeSize / 2 - 1) + "; };\n";
+    source += "int main(int argc, char**) { return EnumInfo<Plain>::valueName(static_cast<Plain>(argc)).has_value(); }\n";
+    return source;
+}
+
+
+int main()
+{
+    const auto baseline = compile("#include \"EnumInfo.h\"\nint main() {}\n");
+    std::cout << "EnumInfo.h alone takes " << std::fixed << std::setprecision(2) << baseline.seconds << " s, "
+              << "times and sizes below are over it" << std::endl;
+
+    std::cout << "--- ENUM_DECLARE_NS ---" << std::endl;
+    for (const size_t size: {100, 1000, 5000})
+    {
+        report(std::to_string(size) + " entries", compile(declareSource(size)), baseline);
+    }
+
+    std::cout << "--- Enum scanned without ENUM_DECLARE ---" << std::endl;
+    for (const long rangeSize: {256L, 1024L, 4096L})
+    {
+        report("EnumScanRange of " + std::to_string(rangeSize) + " values", compile(scanSource(rangeSize)), baseline);
+    }
+    for (const int chunkSize: {16, 256})
+    {
+        report("1024 values, ENUM_INFO_SCAN_CHUNK_SIZE " + std::to_string(chunkSize),
+               compile(scanSource(1024), "-DENUM_INFO_SCAN_CHUNK_SIZE=" + std::to_string(chunkSize)), baseline);
+    }
+}
@@ -1,493 +1,4229 @@
-/**
- * @author Trubnikov Sergey <bugrazoid@gmail.com>
- */
-#pragma once
-
-#include <string>
-#include <array>
-#include <map>
-#include <unordered_map>
-#include <type_traits>
-#include <optional>
-#include <stdexcept>
-#include <assert.h>
-
-
-template<typename Enum, typename String>
-class EnumInfo;
-
-namespace _enum_info_private
-{
-
-template<typename Enum>
-struct Adaptor
-{
-    Enum val;
-    constexpr operator Enum() const {return val;}
-
-    constexpr Adaptor() : val(static_cast<Enum>([]
-    {
-        _val = _val.has_value() ? *_val + 1 : 0;
-        return *_val;
-    }())) {}
-    template<typename U>
-    constexpr Adaptor(U i) : val(static_cast<Enum>(i)) {_val = i;}
-
-    template<typename U>
-    constexpr const Adaptor operator=(const U) const {return *this;}
-
-private:
-    static std::optional<std::underlying_type_t<Enum>> _val;
-};
-
-template<typename Enum>
-std::optional<std::underlying_type_t<Enum>> Adaptor<Enum>::_val = std::nullopt;
-
-/**
- * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
- * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
- */
-constexpr bool isIdentChar(char c)
-{
-    return (c >= 'A' && c <= 'Z') ||
-           (c >= 'a' && c <= 'z') ||
-           (c >= '0' && c <= '9') ||
-           (c == '_');
-}
-
-template<typename Enum>
-struct RawData
-{
-    constexpr RawData(const char* enumName, size_t enumNameSize,
-                      const Enum* vals, size_t valsCount,
-                      const char* rawNames, size_t rawNamesSize)
-        : _enumName(enumName), _enumNameSize(enumNameSize)
-        , _rawNames(rawNames), _rawNamesSize(rawNamesSize)
-        , _vals(vals)        , _valsCount(valsCount)
-    {}
-
-    const char* _enumName;
-    const size_t _enumNameSize;
-    const char* _rawNames;
-    const size_t _rawNamesSize;
-    const Enum* _vals;
-    const size_t _valsCount;
-};
-
-template<typename Enum, typename String>
-struct ParsedData
-{
-    constexpr ParsedData(const char* enumName, size_t enumNameSize, const Enum* vals, size_t valsCount, const char* rawNames, size_t rawNamesSize)
-        : enumName(enumName, enumNameSize)
-        , values(vals)
-        , size(valsCount)
-    {
-        names.reserve(size);
-        parseNames(vals, valsCount, rawNames, rawNamesSize);
-    }
-    constexpr ParsedData(RawData<Enum> rawData)
-        : ParsedData(rawData._enumName, rawData._enumNameSize,
-                     rawData._vals, rawData._valsCount,
-                     rawData._rawNames, rawData._rawNamesSize)
-    {}
-
-    friend EnumInfo<Enum, String>;
-
-private:
-    String enumName;
-    std::vector<String> names;
-    std::multimap<Enum, String> nameByVal;
-    std::unordered_map<String, Enum> valByName;
-    const Enum* values;
-    const size_t size;
-
-    /**
-     * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
-     * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
-     */
-    constexpr void parseNames(const Enum* vals, size_t valsCount, const char* rawNames, size_t rawNamesSize)
-    {
-        enum states
-        {
-            state_start, // Before identifier
-            state_ident, // In identifier
-            state_skip,  // Looking for separator comma
-        } state = state_start;
-
-        const char* begin = nullptr;
-        const char* end = rawNames;
-        size_t value_index = 0;
-        int level = 0;
-        while (end != rawNames + rawNamesSize)
-        {
-            assert(*end);
-            switch (state)
-            {
-            case state_start:
-                if (isIdentChar(*end))
-                {
-                    state = state_ident;
-                    begin = end;
-                }
-                ++end;
-                break;
-            case state_ident:
-                if (!isIdentChar(*end))
-                {
-                    state = state_skip;
-                    assert(value_index < valsCount);
-                    const auto value = vals[value_index];
-                    const String string(begin, size_t(end - begin));
-                    names.push_back(string);
-                    nameByVal.emplace(value, string);
-                    valByName.emplace(string, value);
-                    ++value_index;
-                }
-                else
-                {
-                    ++end;
-                }
-                break;
-            case state_skip:
-                if (*end == '(')
-                {
-                    ++level;
-                }
-                else if (*end == ')')
-                {
-                    if (level == 0)
-                    {
-                        assert(value_index == valsCount);
-                        return;
-                    }
-                    --level;
-                }
-                else if (level == 0 && *end == ',')
-                {
-                    state = state_start;
-                }
-                ++end;
-            }
-        }
-    }
-};
-
-} // namespace _enum_info_private
-
-/**
- * @brief Declare an enumeration inside a class
- * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
- * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
- */
-#define ENUM_DECLARE( enumName, enumType, ... )\
-                              ENUM_INFO_DETAIL_MAKE( class, enumName, enumType, __VA_ARGS__ )
-
-/**
- * @brief Declare an enumeration inside a namespace
- * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
- * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
- */
-#define ENUM_DECLARE_NS( enumName, enumType, ... )\
-                              ENUM_INFO_DETAIL_MAKE( namespace, enumName, enumType, __VA_ARGS__ )
-
-/**
- * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
- * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
- */
-#define ENUM_INFO_DETAIL_SPEC_namespace \
-    extern "C"{/* Protection from being used inside a class body */} \
-    inline
-
-/**
- * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
- * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
- */
-#define ENUM_INFO_DETAIL_SPEC_class friend
-
-/**
- * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
- * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
- */
-#define ENUM_INFO_DETAIL_STR(x) #x
-
-/**
- * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
- * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
- */
-#define ENUM_INFO_DETAIL_MAKE(spec, enumName, enumType, ...)                                    \
-    enum enumName:enumType                                                                      \
-    {                                                                                           \
-        __VA_ARGS__                                                                             \
-    };                                                                                          \
-    ENUM_INFO_DETAIL_SPEC_##spec                                                                \
-    const _enum_info_private::RawData<enumName>& getRawData(enumName = enumName())              \
-    {                                                                                           \
-        constexpr const char* const enumNameStr = ENUM_INFO_DETAIL_STR(enumName);               \
-        constexpr const size_t enumNameStrSize = sizeof(ENUM_INFO_DETAIL_STR(enumName)) - 1;    \
-        static const _enum_info_private::Adaptor<enumName> __VA_ARGS__;                         \
-        static const enumName vals[] = { __VA_ARGS__ };                                         \
-        constexpr size_t valsCount = sizeof(vals)/sizeof(enumName);                             \
-        constexpr const char* const rawNames = ENUM_INFO_DETAIL_STR((__VA_ARGS__));             \
-        constexpr const size_t rawNamesSize = sizeof (ENUM_INFO_DETAIL_STR((__VA_ARGS__))) - 1; \
-        static const _enum_info_private::RawData<enumName> rawData(                             \
-            enumNameStr, enumNameStrSize, vals, valsCount, rawNames, rawNamesSize);             \
-        return rawData;                                                                         \
-    }
-
-template<typename Enum, typename String = std::string_view>
-class EnumInfo
-{
-public:
-    using EnumType = std::underlying_type_t<Enum>;
-
-    static String   name();
-    static size_t   size();
-
-    static std::optional<String>    valueName(Enum value);
-    static std::optional<String>    valueName(size_t index);
-    // TODO: valueNames & aliases
-    static std::optional<Enum>      value(String name);
-    static std::optional<Enum>      value(size_t index);
-    static std::optional<size_t>    index(Enum value);
-    static std::optional<size_t>    index(String name);
-
-    struct iterator
-    {
-        using iterator_category = std::bidirectional_iterator_tag;
-        using value_type  = iterator;
-        using difference_type = std::ptrdiff_t;
-
-        iterator() = delete;
-
-        size_t index();
-        Enum value();
-        String name() const;
-
-        value_type      operator*();
-        iterator&       operator++();
-        iterator        operator++(difference_type);
-        iterator&       operator--();
-        iterator        operator--(difference_type);
-        bool            operator==(iterator) const;
-        bool            operator!=(iterator) const;
-
-    private:
-        friend EnumInfo;
-        explicit iterator(const _enum_info_private::ParsedData<Enum, String>* const parsedData, size_t index);
-
-        const _enum_info_private::ParsedData<Enum, String>* const _parsedData;
-        size_t _index;
-    };
-
-    using reverse_iterator = std::reverse_iterator<iterator>;
-
-    static iterator begin();
-    static iterator end();
-
-    static reverse_iterator rbegin();
-    static reverse_iterator rend();
-
-private:
-    const static _enum_info_private::ParsedData<Enum, String> _parsedData;
-
-    template<typename Ret, typename Key, typename Cont>
-    static std::optional<Ret> find(Key key, Cont cont);
-    static iterator fromIndex(size_t index);
-};
-
-template<typename Enum, typename String>
-const _enum_info_private::ParsedData<Enum, String> EnumInfo<Enum, String>::_parsedData =
-        _enum_info_private::ParsedData<Enum, String>(getRawData(Enum()));
-
-// ---- EnumInfo implementation ----
-
-template<typename Enum, typename String>
-String EnumInfo<Enum, String>::name()
-{
-    return _parsedData.enumName;
-}
-
-template<typename Enum, typename String>
-std::optional<String> EnumInfo<Enum, String>::valueName(Enum value)
-{
-    return EnumInfo::find<String>(value, _parsedData.nameByVal);
-}
-
-template<typename Enum, typename String>
-std::optional<String> EnumInfo<Enum, String>::valueName(size_t index)
-{
-    if (index >= _parsedData.names.size())
-        return std::nullopt;
-
-    return _parsedData.names[index];
-}
-
-template<typename Enum, typename String>
-std::optional<Enum> EnumInfo<Enum, String>::value(String name)
-{
-    return EnumInfo::find<Enum>(name, _parsedData.valByName);
-}
-
-template<typename Enum, typename String>
-std::optional<Enum> EnumInfo<Enum, String>::value(size_t index)
-{
-    if (index >= _parsedData.size)
-        return std::nullopt;
-    return _parsedData.values[index];
-}
-
-template<typename Enum, typename String>
-std::optional<size_t> EnumInfo<Enum, String>::index(Enum value)
-{
-    for (size_t i = 0; i < _parsedData.size; ++i)
-    {
-        if (_parsedData.values[i] == value)
-            return i;
-    }
-    return std::nullopt;
-}
-
-template<typename Enum, typename String>
-std::optional<size_t> EnumInfo<Enum, String>::index(String name)
-{
-    const auto it = std::find(_parsedData.names.begin(), _parsedData.names.end(), name);
-    if (it == _parsedData.names.end())
-        return std::nullopt;
-    return std::distance(_parsedData.names.begin(), it);
-}
-
-template<typename Enum, typename String>
-size_t EnumInfo<Enum, String>::size()
-{
-    return _parsedData.size;
-}
-
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::begin()
-{
-    return iterator(&_parsedData, 0);
-}
-
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::end()
-{
-    return iterator(&_parsedData, size());
-}
-
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::reverse_iterator EnumInfo<Enum, String>::rbegin()
-{
-    return iterator(_parsedData.nameByVal.begin());
-}
-
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::reverse_iterator EnumInfo<Enum, String>::rend()
-{
-    return iterator(_parsedData.nameByVal.end());
-}
-
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::fromIndex(size_t index)
-{
-    iterator it(_parsedData.nameByVal.begin());
-    for (size_t i = 0; i != index; ++i)
-    {
-        ++it;
-    }
-    return it;
-}
-
-template<typename Enum, typename String>
-template<typename Ret, typename Key, typename Cont>
-std::optional<Ret> EnumInfo<Enum, String>::find(Key key, Cont cont)
-{
-    const auto it = cont.find(key);
-    if (it != cont.end())
-    {
-        return it->second;
-    }
-
-    return std::nullopt;
-}
-
-// ---- EnumInfo::iterator implementation ----
-
-template<typename Enum, typename String>
-EnumInfo<Enum, String>::iterator::iterator(const _enum_info_private::ParsedData<Enum, String>* const parsedData, size_t index)
-    : _parsedData(parsedData)
-    , _index(index)
-{
-    assert(_parsedData != nullptr);
-    assert(_index <= _parsedData->size);
-}
-
-template<typename Enum, typename String>
-size_t EnumInfo<Enum, String>::iterator::index()
-{
-    return _index;
-}
-
-template<typename Enum, typename String>
-Enum EnumInfo<Enum, String>::iterator::value()
-{
-    return _parsedData->values[_index];
-}
-
-template<typename Enum, typename String>
-String EnumInfo<Enum, String>::iterator::name() const
-{
-    return  _parsedData->names[_index];
-}
-
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::iterator::value_type EnumInfo<Enum, String>::iterator::operator*()
-{
-    return *this;
-}
-
-/// Prefix operator++
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::iterator& EnumInfo<Enum, String>::iterator::operator++()
-{
-    ++_index;
-    return *this;
-}
-
-/// Postfix operator++
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::iterator::operator++(EnumInfo::iterator::difference_type)
-{
-    EnumInfo<Enum, String>::iterator tmp(*this);
-    operator++();
-    return tmp;
-}
-
-/// Prefix operator--
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::iterator& EnumInfo<Enum, String>::iterator::operator--()
-{
-    --_index;
-    return *this;
-}
-
-/// Postfix operator--
-template<typename Enum, typename String>
-typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::iterator::operator--(EnumInfo::iterator::difference_type)
-{
-    EnumInfo<Enum, String>::iterator tmp(*this);
-    operator--();
-    return tmp;
-}
-
-template<typename Enum, typename String>
-bool EnumInfo<Enum, String>::iterator::operator==(EnumInfo::iterator other) const
-{
-    return _parsedData == other._parsedData
-           && _index == other._index;
-}
-
-template<typename Enum, typename String>
-bool EnumInfo<Enum, String>::iterator::operator!=(EnumInfo::iterator other) const
-{
-    return !(*this == other);
-}
+/**
+ * @author Trubnikov Sergey <bugrazoid@gmail.com>
+ */
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <optional>
+#include <stdexcept>
+#include <assert.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#if __cplusplus >= 202002L && __has_include(<format>)
+#include <format>
+#endif
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+#if __cplusplus >= 202002L && __has_include(<ranges>)
+#include <ranges>
+#endif
+
+#ifndef ENUM_INFO_SMALL_NAME_INDEX_MAX_SIZE
+/// Enums up to this size (at most 32) look up names by comparing packed name lengths and
+/// hashes with SIMD instead of the perfect hash, 0 disables it
+#define ENUM_INFO_SMALL_NAME_INDEX_MAX_SIZE 32
+#endif
+
+#ifndef ENUM_INFO_STATS
+/// 1 counts lookups and misses of every enum, see EnumLookupStats, 0 compiles the counting out
+#define ENUM_INFO_STATS 0
+#endif
+
+#ifndef ENUM_INFO_STATS_LATENCY
+/// 1 also collects lookup latency histograms when ENUM_INFO_STATS is 1, reads the clock twice per lookup
+#define ENUM_INFO_STATS_LATENCY 0
+#endif
+
+#ifndef ENUM_INFO_REGISTRY
+/// 1 registers every enum declared by ENUM_DECLARE or ENUM_DECLARE_NS in EnumRegistry
+#define ENUM_INFO_REGISTRY 0
+#endif
+
+#ifndef ENUM_INFO_SCAN
+/**
+ * 1 reflects enums not declared by ENUM_DECLARE or ENUM_DECLARE_NS by scanning values of
+ * EnumScanRange at compile time for names in compiler generated function signatures. Off by
+ * default, so that a missing ENUM_DECLARE stays a compile error. Only enums with a fixed
+ * underlying type may be scanned, casting other ones to values out of their range is ill-formed.
+ */
+#define ENUM_INFO_SCAN 0
+#endif
+
+#ifndef ENUM_INFO_SCAN_MIN
+/// Default lowest value scanned for names of enums not declared by ENUM_DECLARE or ENUM_DECLARE_NS
+#define ENUM_INFO_SCAN_MIN -128
+#endif
+
+#ifndef ENUM_INFO_SCAN_MAX
+/// Default highest value scanned for names of enums not declared by ENUM_DECLARE or ENUM_DECLARE_NS
+#define ENUM_INFO_SCAN_MAX 127
+#endif
+
+#ifndef ENUM_INFO_SCAN_CHUNK_SIZE
+/// Values scanned by one template instantiation, bounds the size of template argument packs
+#define ENUM_INFO_SCAN_CHUNK_SIZE 64
+#endif
+
+#if ENUM_INFO_STATS
+#include <atomic>
+#include <chrono>
+#include <ostream>
+#endif
+
+#if ENUM_INFO_REGISTRY
+#include <atomic>
+#include <mutex>
+#include <vector>
+#endif
+
+
+template<typename Enum, typename String>
+class EnumInfo;
+
+template<typename Enum>
+class EnumNameScanner;
+
+/**
+ * Values scanned for names of @p Enum when it is not declared by ENUM_DECLARE or ENUM_DECLARE_NS,
+ * specialize it to widen or narrow the range of one enum. Compile time grows with the range size.
+ */
+template<typename Enum>
+struct EnumScanRange
+{
+    static constexpr int64_t min = ENUM_INFO_SCAN_MIN;
+    static constexpr int64_t max = ENUM_INFO_SCAN_MAX;
+};
+
+/// Name folding for EnumInfo::value(name, fold): "https" and "HTTPS" are the same name
+struct IgnoreCase
+{
+    /// Canonical form of @p c, '\0' for characters which are skipped
+    static constexpr char fold(char c)
+    {
+        return c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c;
+    }
+
+    /// fold() of 8 characters at once, optional and only for folds which skip no characters
+    static constexpr uint64_t foldWord(uint64_t word)
+    {
+        constexpr uint64_t ones = 0x0101010101010101ull;
+        constexpr uint64_t high = 0x8080808080808080ull;
+        const uint64_t low = word & ~high;
+        const uint64_t upper = (low + (0x80 - 'A') * ones) & ~(low + (0x80 - 'Z' - 1) * ones) & ~word & high;
+        return word | (upper >> 2);
+    }
+};
+
+/// Name folding for EnumInfo::value(name, fold): "TCP_PORT", "tcp-port" and "TcpPort" are the same name
+struct IgnoreCaseAndSeparators
+{
+    static constexpr char fold(char c)
+    {
+        return c == '_' || c == '-' ? '\0' : IgnoreCase::fold(c);
+    }
+};
+
+namespace _enum_info_private
+{
+
+/**
+ * Stands in for each enumerator inside getRawData() so that "Name = expr" becomes a valid
+ * expression. getRawData() evaluates the enumerator list twice: declaring the adaptors, when
+ * implicit values are not known yet, and then building EnumeratorValues in declaration order,
+ * which assign every "Name = expr" again and resolve implicit values as soon as they are reached,
+ * so that later initializers like "C = A | B" see them.
+ */
+template<typename Enum>
+struct Adaptor
+{
+    using EnumType = std::underlying_type_t<Enum>;
+
+    constexpr Adaptor() : _value(0), _isImplicit(true) {}
+    template<typename U, typename = std::enable_if_t<std::is_integral_v<U> || std::is_enum_v<U>>>
+    constexpr Adaptor(U i) : _value(static_cast<EnumType>(i)), _isImplicit(false) {}
+
+    /// A placeholder 0 for implicit values while the adaptors are declared
+    constexpr operator Enum() const { return static_cast<Enum>(_value); }
+
+    template<typename U>
+    constexpr Adaptor& operator=(const U value)
+    {
+        _value = static_cast<EnumType>(static_cast<Enum>(value));
+        _isImplicit = false;
+        return *this;
+    }
+
+    EnumType _value;
+    bool _isImplicit;   ///< No initializer and not reached by EnumeratorValue yet
+};
+
+/**
+ * Value of an enumerator in an array in declaration order, after a default constructed start
+ * entry. An implicit value is previous + 1 and is written back to its adaptor.
+ */
+template<typename Enum>
+struct EnumeratorValue
+{
+    constexpr EnumeratorValue() : value(), isStart(true) {}
+    constexpr EnumeratorValue(Enum value) : value(value), isStart(false) {}
+    constexpr EnumeratorValue(Adaptor<Enum>& adaptor)
+        : value(), isStart(false)
+    {
+        if (adaptor._isImplicit)
+        {
+            // Previous entries of the array are initialized already
+            const EnumeratorValue& previous = this[-1];
+            using EnumType = typename Adaptor<Enum>::EnumType;
+            adaptor = previous.isStart ? Enum{} : static_cast<Enum>(static_cast<EnumType>(previous.value) + 1);
+        }
+        value = static_cast<Enum>(adaptor._value);
+    }
+
+    Enum value;
+    bool isStart;
+};
+
+/**
+ * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
+ * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
+ */
+constexpr bool isIdentChar(char c)
+{
+    return (c >= 'A' && c <= 'Z') ||
+           (c >= 'a' && c <= 'z') ||
+           (c >= '0' && c <= '9') ||
+           (c == '_');
+}
+
+/// isIdentChar() of every char as a table, for scanning long texts
+constexpr std::array<bool, 256> identChars = []
+{
+    std::array<bool, 256> table{};
+    for (size_t c = 0; c < table.size(); ++c)
+    {
+        table[c] = isIdentChar(static_cast<char>(c));
+    }
+    return table;
+}();
+
+template<typename Enum, size_t N>
+struct RawData
+{
+    template<size_t EnumNameSize, size_t RawNamesSize>
+    constexpr RawData(const char (&enumName)[EnumNameSize],
+                      const char (&rawNames)[RawNamesSize],
+                      const EnumeratorValue<Enum> (&vals)[N + 1])
+        : RawData(std::string_view(enumName, EnumNameSize - 1), std::string_view(rawNames, RawNamesSize - 1), vals)
+    {
+    }
+
+    /// @p rawNames are "(Name, Name = value, ...)" and must outlive the RawData
+    /// @p vals start with the start entry of EnumeratorValue
+    constexpr RawData(std::string_view enumName, std::string_view rawNames, const EnumeratorValue<Enum> (&vals)[N + 1])
+        : _enumName(enumName.data()), _enumNameSize(enumName.size())
+        , _rawNames(rawNames.data()), _rawNamesSize(rawNames.size())
+        , _vals{}
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            _vals[i] = vals[i + 1].value;
+        }
+    }
+
+    const char* _enumName;
+    size_t _enumNameSize;
+    const char* _rawNames;
+    size_t _rawNamesSize;
+    std::array<Enum, N> _vals;
+};
+
+/// Smallest unsigned type able to hold any index below @p N and @p N itself as "not found" marker
+template<size_t N>
+using IndexType = std::conditional_t<(N < std::numeric_limits<uint8_t>::max()), uint8_t,
+                  std::conditional_t<(N < std::numeric_limits<uint16_t>::max()), uint16_t,
+                  std::conditional_t<(N < std::numeric_limits<uint32_t>::max()), uint32_t, size_t>>>;
+
+/// Smallest unsigned type able to hold any index below @p N, codes of EnumInfo::encode()
+template<size_t N>
+using CodeType = std::conditional_t<(N <= size_t(std::numeric_limits<uint8_t>::max()) + 1), uint8_t,
+                 std::conditional_t<(N <= size_t(std::numeric_limits<uint16_t>::max()) + 1), uint16_t, uint32_t>>;
+
+/**
+ * Names are not copied: they are views into the stringized enumerator list, located by offsets
+ * and sizes of the smallest type able to address it, so an entry takes a few bytes
+ */
+template<typename Enum, size_t N, size_t RawNamesSize>
+struct ParsedData
+{
+    constexpr ParsedData(const RawData<Enum, N>& rawData)
+        : enumName(rawData._enumName, rawData._enumNameSize)
+        , rawNames(rawData._rawNames)
+        , values(rawData._vals)
+        , nameOffsets{}
+        , nameSizes{}
+    {
+        parseNames(rawData._rawNamesSize);
+    }
+
+    constexpr std::string_view name(size_t index) const
+    {
+        return std::string_view(rawNames + nameOffsets[index], nameSizes[index]);
+    }
+
+    std::string_view enumName;
+    const char* rawNames;
+    std::array<Enum, N> values;
+    std::array<IndexType<RawNamesSize>, N> nameOffsets;
+    std::array<IndexType<RawNamesSize>, N> nameSizes;
+
+private:
+    /**
+     * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
+     * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
+     */
+    constexpr void parseNames(size_t rawNamesSize)
+    {
+        enum states
+        {
+            state_start, // Before identifier
+            state_ident, // In identifier
+            state_skip,  // Looking for separator comma
+        } state = state_start;
+
+        const char* begin = nullptr;
+        const char* end = rawNames;
+        size_t value_index = 0;
+        int level = 0;
+        while (end != rawNames + rawNamesSize)
+        {
+            assert(*end);
+            switch (state)
+            {
+            case state_start:
+                if (isIdentChar(*end))
+                {
+                    state = state_ident;
+                    begin = end;
+                }
+                ++end;
+                break;
+            case state_ident:
+                if (!isIdentChar(*end))
+                {
+                    state = state_skip;
+                    assert(value_index < N);
+                    nameOffsets[value_index] = static_cast<IndexType<RawNamesSize>>(begin - rawNames);
+                    nameSizes[value_index] = static_cast<IndexType<RawNamesSize>>(end - begin);
+                    ++value_index;
+                }
+                else
+                {
+                    ++end;
+                }
+                break;
+            case state_skip:
+                if (*end == '(')
+                {
+                    ++level;
+                }
+                else if (*end == ')')
+                {
+                    if (level == 0)
+                    {
+                        assert(value_index == N);
+                        return;
+                    }
+                    --level;
+                }
+                else if (level == 0 && *end == ',')
+                {
+                    state = state_start;
+                }
+                ++end;
+            }
+        }
+    }
+};
+
+/**
+ * Stable merge sort of ascending runs, since std::sort is not constexpr before C++20.
+ * Values are mostly declared in ascending order, so it takes one linear pass for most enums.
+ */
+template<typename T, size_t N, typename Less>
+constexpr void sort(std::array<T, N>& array, Less less)
+{
+    const auto runEnd = [&less](const std::array<T, N>& from, size_t first)
+    {
+        size_t last = first + 1;
+        while (last < N && !less(from[last], from[last - 1]))
+        {
+            ++last;
+        }
+        return last;
+    };
+
+    if (N < 2 || runEnd(array, 0) == N)
+        return;
+
+    std::array<T, N> buffer{};
+    std::array<T, N>* from = &array;
+    std::array<T, N>* to = &buffer;
+    for (bool isSorted = false; !isSorted;)
+    {
+        isSorted = true;
+        // Merges pairs of adjacent runs
+        for (size_t first = 0; first < N;)
+        {
+            const size_t middle = runEnd(*from, first);
+            const size_t last = middle < N ? runEnd(*from, middle) : N;
+            isSorted = isSorted && first == 0 && last == N;
+            for (size_t l = first, r = middle, out = first; out < last; ++out)
+            {
+                (*to)[out] = r == last || (l < middle && !less((*from)[r], (*from)[l])) ? (*from)[l++] : (*from)[r++];
+            }
+            first = last;
+        }
+        std::array<T, N>* const merged = to;
+        to = from;
+        from = merged;
+    }
+    if (from != &array)
+        array = *from;
+}
+
+/**
+ * Size of the table for a direct value-to-index mapping or 0 when values are too sparse,
+ * so that the table would take more than two slots per enumerator
+ */
+template<typename Enum, size_t N>
+constexpr size_t denseRange(const std::array<Enum, N>& values)
+{
+    using Unsigned = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+
+    if (N == 0)
+        return 0;
+
+    auto min = values[0];
+    auto max = values[0];
+    for (const auto value: values)
+    {
+        min = value < min ? value : min;
+        max = value > max ? value : max;
+    }
+    const auto range = static_cast<Unsigned>(static_cast<Unsigned>(max) - static_cast<Unsigned>(min));
+    return range < 2 * N ? size_t(range) + 1 : 0;
+}
+
+/// Value-to-index mapping of dense enums: one table slot per value in [min, max]
+template<typename Enum, size_t N, size_t Range>
+struct ValueIndex
+{
+    using Unsigned = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+
+    constexpr ValueIndex(const std::array<Enum, N>& values)
+        : min(0)
+        , indexes{}
+    {
+        auto minValue = values[0];
+        for (const auto value: values)
+        {
+            minValue = value < minValue ? value : minValue;
+        }
+        min = static_cast<Unsigned>(minValue);
+        for (auto& index: indexes)
+        {
+            index = static_cast<IndexType<N>>(N);
+        }
+        // Go backward, so first of aliases wins
+        for (size_t i = N; i-- > 0;)
+        {
+            indexes[static_cast<Unsigned>(static_cast<Unsigned>(values[i]) - min)] = static_cast<IndexType<N>>(i);
+        }
+    }
+
+    constexpr std::optional<size_t> find(Enum value) const
+    {
+        const auto offset = static_cast<Unsigned>(static_cast<Unsigned>(value) - min);
+        if (offset >= Range || indexes[offset] == N)
+            return std::nullopt;
+        return indexes[offset];
+    }
+
+    /// Whether some value has several names, that is fewer slots than names are taken
+    constexpr bool hasAliases() const
+    {
+        size_t taken = 0;
+        for (const auto index: indexes)
+        {
+            taken += index != N ? 1 : 0;
+        }
+        return taken != N;
+    }
+
+    Unsigned min;
+    std::array<IndexType<N>, Range> indexes;
+};
+
+/**
+ * Value-to-index mapping of sparse enums: binary search over values sorted at compile time.
+ * Values and indexes are separate arrays, so that neither is padded.
+ */
+template<typename Enum, size_t N>
+struct ValueIndex<Enum, N, 0>
+{
+    constexpr ValueIndex(const std::array<Enum, N>& values)
+        : sortedValues{}
+        , indexes{}
+    {
+        struct Entry
+        {
+            Enum value;
+            IndexType<N> index;
+        };
+
+        std::array<Entry, N> entries{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            entries[i] = Entry{values[i], static_cast<IndexType<N>>(i)};
+        }
+        // Among aliases the first declared goes first
+        sort(entries, [](const Entry& l, const Entry& r)
+        {
+            return l.value < r.value || (l.value == r.value && l.index < r.index);
+        });
+        for (size_t i = 0; i < N; ++i)
+        {
+            sortedValues[i] = entries[i].value;
+            indexes[i] = entries[i].index;
+        }
+    }
+
+    constexpr std::optional<size_t> find(Enum value) const
+    {
+        size_t first = 0;
+        size_t count = N;
+        while (count > 0)
+        {
+            const size_t step = count / 2;
+            if (sortedValues[first + step] < value)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+        if (first == N || sortedValues[first] != value)
+            return std::nullopt;
+        return indexes[first];
+    }
+
+    /// Whether some value has several names, they are adjacent after sorting
+    constexpr bool hasAliases() const
+    {
+        for (size_t i = 1; i < N; ++i)
+        {
+            if (sortedValues[i] == sortedValues[i - 1])
+                return true;
+        }
+        return false;
+    }
+
+    std::array<Enum, N> sortedValues;
+    std::array<IndexType<N>, N> indexes;
+};
+
+/**
+ * Indexes grouped by value, so that all names of a value are a contiguous span.
+ * The first declared name of a value is canonical, the others are aliases.
+ */
+template<size_t N, bool HasAliases>
+struct AliasIndex
+{
+    template<typename Enum, typename ValueIndex>
+    constexpr AliasIndex(const std::array<Enum, N>& values, const ValueIndex& valueIndex)
+        : canonical{}
+        , groupStarts{}
+        , grouped{}
+    {
+        // Counting sort by canonical index keeps declaration order within a group
+        for (size_t i = 0; i < N; ++i)
+        {
+            canonical[i] = static_cast<IndexType<N>>(*valueIndex.find(values[i]));
+            ++groupStarts[canonical[i] + 1];
+        }
+        for (size_t i = 1; i <= N; ++i)
+        {
+            groupStarts[i] = static_cast<IndexType<N>>(groupStarts[i] + groupStarts[i - 1]);
+        }
+        std::array<IndexType<N>, N + 1> ends = groupStarts;
+        for (size_t i = 0; i < N; ++i)
+        {
+            grouped[ends[canonical[i]]++] = static_cast<IndexType<N>>(i);
+        }
+    }
+
+    constexpr size_t canonicalIndex(size_t index) const { return canonical[index]; }
+    constexpr const IndexType<N>* groupedIndexes() const { return grouped.data(); }
+    constexpr size_t groupBegin(size_t canonicalIndex) const { return groupStarts[canonicalIndex]; }
+    constexpr size_t groupEnd(size_t canonicalIndex) const { return groupStarts[canonicalIndex + 1]; }
+
+    std::array<IndexType<N>, N> canonical;
+    std::array<IndexType<N>, N + 1> groupStarts; ///< By canonical index, empty groups for aliases
+    std::array<IndexType<N>, N> grouped;
+};
+
+/// Every value has one name: groups are single indexes and nothing is stored
+template<size_t N>
+struct AliasIndex<N, false>
+{
+    template<typename Enum, typename ValueIndex>
+    constexpr AliasIndex(const std::array<Enum, N>&, const ValueIndex&) {}
+
+    constexpr size_t canonicalIndex(size_t index) const { return index; }
+    constexpr const IndexType<N>* groupedIndexes() const { return nullptr; }
+    constexpr size_t groupBegin(size_t canonicalIndex) const { return canonicalIndex; }
+    constexpr size_t groupEnd(size_t canonicalIndex) const { return canonicalIndex + 1; }
+};
+
+constexpr bool isConstantEvaluated()
+{
+#if defined(__cpp_lib_is_constant_evaluated)
+    return std::is_constant_evaluated();
+#else
+    return __builtin_is_constant_evaluated();
+#endif
+}
+
+/// Reads @p count (up to 8) bytes of @p name from @p offset as little-endian integer
+constexpr uint64_t loadWord(std::string_view name, size_t offset, size_t count)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (!isConstantEvaluated())
+    {
+        const char* data = name.data() + offset;
+        if (count == 8)
+        {
+            uint64_t word = 0;
+            std::memcpy(&word, data, 8);
+            return word;
+        }
+        if (count >= 4)
+        {
+            uint32_t low = 0;
+            uint32_t high = 0;
+            std::memcpy(&low, data, 4);
+            std::memcpy(&high, data + count - 4, 4);
+            return low | ((uint64_t(high) >> (8 * (8 - count))) << 32);
+        }
+        if (count > 0)
+        {
+            return uint64_t(static_cast<unsigned char>(data[0]))
+                 | uint64_t(static_cast<unsigned char>(data[count / 2])) << (8 * (count / 2))
+                 | uint64_t(static_cast<unsigned char>(data[count - 1])) << (8 * (count - 1));
+        }
+        return 0;
+    }
+#endif
+    // Pointer reads instead of string_view::operator[] calls, which are slow to evaluate at compile time
+    const char* data = name.data() + offset;
+    uint64_t word = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        word |= uint64_t(static_cast<unsigned char>(data[i])) << (8 * i);
+    }
+    return word;
+}
+
+/// Word fold of names compared as they are
+struct KeepWord
+{
+    static constexpr uint64_t foldWord(uint64_t word)
+    {
+        return word;
+    }
+};
+
+/**
+ * Multiply-xorshift hash over 8 byte words, so that all bits of the result depend on the name.
+ * Words are folded by @p WordFold::foldWord() first.
+ */
+template<typename WordFold = KeepWord>
+constexpr uint64_t hashName(std::string_view name, uint64_t seed)
+{
+    constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+    uint64_t hash = (seed + name.size()) * multiplier;
+    uint64_t lastWord = 0;
+    if (isConstantEvaluated())
+    {
+        // Same words gathered byte by byte in one loop, calls are what makes compile time evaluation slow
+        const char* data = name.data();
+        for (size_t i = 0; i < name.size(); ++i)
+        {
+            lastWord |= uint64_t(static_cast<unsigned char>(data[i])) << (8 * (i % 8));
+            if (i % 8 == 7)
+            {
+                hash = (hash ^ WordFold::foldWord(lastWord)) * multiplier;
+                hash ^= hash >> 32;
+                lastWord = 0;
+            }
+        }
+    }
+    else
+    {
+        size_t offset = 0;
+        for (; offset + 8 <= name.size(); offset += 8)
+        {
+            hash = (hash ^ WordFold::foldWord(loadWord(name, offset, 8))) * multiplier;
+            hash ^= hash >> 32;
+        }
+        lastWord = loadWord(name, offset, name.size() - offset);
+    }
+    hash = (hash ^ WordFold::foldWord(lastWord)) * multiplier;
+    hash ^= hash >> 29;
+    hash *= 0xBF58476D1CE4E5B9ull;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+template<typename WordFold>
+constexpr bool equalFoldedWords(std::string_view l, std::string_view r)
+{
+    const auto equalWords = [l, r](size_t offset, size_t count)
+    {
+        return WordFold::foldWord(loadWord(l, offset, count)) == WordFold::foldWord(loadWord(r, offset, count));
+    };
+
+    if (l.size() != r.size())
+        return false;
+    if (l.size() < 8)
+        return equalWords(0, l.size());
+    for (size_t offset = 0; offset + 8 < l.size(); offset += 8)
+    {
+        if (!equalWords(offset, 8))
+            return false;
+    }
+    // Last word overlaps the previous one instead of being partial
+    return equalWords(l.size() - 8, 8);
+}
+
+/// Fold::fold() of every character, so that folding a name takes no branches
+template<typename Fold>
+struct FoldTable
+{
+    static constexpr std::array<char, 256> make()
+    {
+        std::array<char, 256> table{};
+        for (size_t c = 0; c < table.size(); ++c)
+        {
+            table[c] = Fold::fold(static_cast<char>(c));
+        }
+        return table;
+    }
+
+    static constexpr std::array<char, 256> table = make();
+};
+
+/// Reads a name folded by Fold in words of 8 characters, skipped characters removed
+template<typename Fold>
+class FoldedWords
+{
+public:
+    constexpr explicit FoldedWords(std::string_view name) : _name(name), _offset(0) {}
+
+    /// Stores the next word to @p word and returns the number of its characters, less than 8 at the end
+    constexpr size_t next(uint64_t& word)
+    {
+        word = 0;
+        size_t count = 0;
+        for (; count < 8 && _offset < _name.size(); ++_offset)
+        {
+            const char folded = FoldTable<Fold>::table[static_cast<unsigned char>(_name[_offset])];
+            word |= uint64_t(static_cast<unsigned char>(folded)) << (8 * count);
+            count += folded != '\0';
+        }
+        return count;
+    }
+
+private:
+    std::string_view _name;
+    size_t _offset;
+};
+
+/// hashName() of a name folded on the fly, so that lookup needs no folded copy
+template<typename Fold>
+constexpr uint64_t hashFoldedName(std::string_view name, uint64_t seed)
+{
+    constexpr uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+
+    uint64_t hash = seed * multiplier;
+    FoldedWords<Fold> words(name);
+    uint64_t word = 0;
+    size_t size = 0;
+    size_t count = words.next(word);
+    for (; count == 8; count = words.next(word))
+    {
+        hash = (hash ^ word) * multiplier;
+        hash ^= hash >> 32;
+        size += count;
+    }
+    hash = (hash ^ word ^ (uint64_t(size + count) << 56)) * multiplier;
+    hash ^= hash >> 29;
+    hash *= 0xBF58476D1CE4E5B9ull;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+template<typename Fold>
+constexpr bool equalFolded(std::string_view l, std::string_view r)
+{
+    FoldedWords<Fold> lWords(l);
+    FoldedWords<Fold> rWords(r);
+    while (true)
+    {
+        uint64_t lWord = 0;
+        uint64_t rWord = 0;
+        const size_t count = lWords.next(lWord);
+        if (rWords.next(rWord) != count || lWord != rWord)
+            return false;
+        if (count < 8)
+            return true;
+    }
+}
+
+/// Names of NameIndex compared as they are
+struct ExactName
+{
+    static constexpr uint64_t hash(std::string_view name, uint64_t seed)
+    {
+        return hashName<>(name, seed);
+    }
+
+    static constexpr bool equal(std::string_view l, std::string_view r)
+    {
+        return l == r;
+    }
+};
+
+template<typename Fold, typename = void>
+struct HasFoldWord : std::false_type {};
+
+template<typename Fold>
+struct HasFoldWord<Fold, std::void_t<decltype(Fold::foldWord(uint64_t()))>> : std::true_type {};
+
+/**
+ * Names of NameIndex compared after folding, names equal to an earlier one get no slot.
+ * Folds with foldWord() are applied a word at a time.
+ */
+template<typename Fold>
+struct FoldedName
+{
+    static constexpr uint64_t hash(std::string_view name, uint64_t seed)
+    {
+        if constexpr (HasFoldWord<Fold>::value)
+            return hashName<Fold>(name, seed);
+        else
+            return hashFoldedName<Fold>(name, seed);
+    }
+
+    static constexpr bool equal(std::string_view l, std::string_view r)
+    {
+        if constexpr (HasFoldWord<Fold>::value)
+            return equalFoldedWords<Fold>(l, r);
+        else
+            return equalFolded<Fold>(l, r);
+    }
+};
+
+/// Maps @p x to [0, n) without division
+constexpr uint32_t fastRange(uint32_t x, size_t n)
+{
+    return static_cast<uint32_t>((uint64_t(x) * n) >> 32);
+}
+
+/**
+ * Minimal perfect hash of enumerator names ("hash and displace"), built at compile time.
+ * A name is hashed once, the upper half selects a bucket and the bucket displacement moves
+ * the lower half to the slot holding the index of the only name which can be equal.
+ */
+template<size_t N, typename Name = ExactName>
+struct NameIndex
+{
+    static constexpr size_t bucketCount()
+    {
+        size_t count = 1;
+        while (count < N / 2)
+        {
+            count *= 2;
+        }
+        return count;
+    }
+
+    /// A quarter of the slots stays empty, placing the last buckets into a full table is what
+    /// makes building big indexes slow
+    static constexpr size_t slotCount()
+    {
+        return N + N / 4;
+    }
+
+    template<typename Enum, size_t RawNamesSize>
+    constexpr NameIndex(const ParsedData<Enum, N, RawNamesSize>& parsedData)
+        : seed(0)
+        , displacements{}
+        , slots{}
+    {
+        while (!build(parsedData))
+        {
+            ++seed;
+        }
+    }
+
+    /// Index of the only name that may be equal to @p name, N if there is none
+    constexpr size_t candidate(std::string_view name) const
+    {
+        const uint64_t hash = Name::hash(name, seed);
+        const uint32_t low = static_cast<uint32_t>(hash);
+        const uint32_t high = static_cast<uint32_t>(hash >> 32) | 1;
+        const uint32_t displacement = displacements[high & (bucketCount() - 1)];
+        return slots[fastRange(low + displacement * high, slotCount())];
+    }
+
+    uint64_t seed;
+    std::array<uint16_t, bucketCount()> displacements;
+    std::array<IndexType<N>, slotCount()> slots;
+
+private:
+    static constexpr uint32_t maxDisplacement = 1u << 16;
+    static constexpr size_t maxBucketSize = 16; ///< Bigger buckets are practically impossible, a new seed is tried
+
+    template<typename Enum, size_t RawNamesSize>
+    constexpr bool build(const ParsedData<Enum, N, RawNamesSize>& parsedData)
+    {
+        struct Key
+        {
+            uint32_t low;
+            uint32_t high;
+            size_t bucket;
+            size_t bucketSize;
+            size_t index;
+        };
+
+        std::array<Key, N> keys{};
+        std::array<size_t, bucketCount()> bucketSizes{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            const uint64_t hash = Name::hash(parsedData.name(i), seed);
+            keys[i].low = static_cast<uint32_t>(hash);
+            keys[i].high = static_cast<uint32_t>(hash >> 32) | 1;
+            keys[i].bucket = keys[i].high & (bucketCount() - 1);
+            keys[i].index = i;
+            ++bucketSizes[keys[i].bucket];
+        }
+        // Counting sorts by bucket and then by bucket size keep buckets contiguous and place the
+        // biggest ones first, while the table is still empty. Comparison sorting made big enums
+        // exceed the compiler's constexpr evaluation limit.
+        std::array<size_t, bucketCount()> bucketStarts{};
+        for (size_t bucket = 1; bucket < bucketCount(); ++bucket)
+        {
+            bucketStarts[bucket] = bucketStarts[bucket - 1] + bucketSizes[bucket - 1];
+        }
+        std::array<Key, N> byBucket{};
+        for (auto& key: keys)
+        {
+            key.bucketSize = bucketSizes[key.bucket];
+            byBucket[bucketStarts[key.bucket]++] = key;
+        }
+        std::array<size_t, N + 1> sizeStarts{};
+        for (const auto& key: byBucket)
+        {
+            ++sizeStarts[key.bucketSize];
+        }
+        for (size_t size = N + 1, start = 0; size-- > 0;)
+        {
+            const size_t count = sizeStarts[size];
+            sizeStarts[size] = start;
+            start += count;
+        }
+        for (const auto& key: byBucket)
+        {
+            keys[sizeStarts[key.bucketSize]++] = key;
+        }
+
+        for (auto& slot: slots)
+        {
+            slot = static_cast<IndexType<N>>(N);
+        }
+        for (size_t first = 0; first < N; first += keys[first].bucketSize)
+        {
+            // The bucket is copied into a small array, since element access into big arrays is
+            // what makes compile time evaluation slow
+            const size_t bucketSize = keys[first].bucketSize;
+            std::array<Key, maxBucketSize> bucket{};
+            size_t size = 0;
+            for (size_t i = first; i < first + bucketSize; ++i)
+            {
+                // Equal folded names hash alike whatever the seed, only the first declared one is
+                // placed and the others don't count against maxBucketSize
+                bool duplicate = false;
+                for (size_t j = 0; j < size && !duplicate; ++j)
+                {
+                    duplicate = bucket[j].low == keys[i].low && bucket[j].high == keys[i].high
+                                && Name::equal(parsedData.name(bucket[j].index), parsedData.name(keys[i].index));
+                }
+                if (duplicate)
+                    continue;
+                if (size == maxBucketSize)
+                    return false;
+                bucket[size++] = keys[i];
+            }
+
+            bool placed = false;
+            for (uint32_t displacement = 0; !placed && displacement < maxDisplacement; ++displacement)
+            {
+                size_t i = 0;
+                for (; i < size; ++i)
+                {
+                    const auto slot = fastRange(bucket[i].low + displacement * bucket[i].high, slotCount());
+                    if (slots[slot] != N)
+                        break;
+                    slots[slot] = static_cast<IndexType<N>>(bucket[i].index);
+                }
+                placed = i == size;
+                if (placed)
+                {
+                    displacements[bucket[0].bucket] = static_cast<uint16_t>(displacement);
+                }
+                // Roll back partially placed bucket
+                while (!placed && i-- > 0)
+                {
+                    slots[fastRange(bucket[i].low + displacement * bucket[i].high, slotCount())] = static_cast<IndexType<N>>(N);
+                }
+            }
+            if (!placed)
+                return false;
+        }
+        return true;
+    }
+};
+
+constexpr size_t countTrailingZeros(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return size_t(__builtin_ctzll(x));
+#else
+    size_t count = 0;
+    for (; (x & 1) == 0; x >>= 1)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+constexpr size_t popCount(uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return size_t(__builtin_popcountll(x));
+#else
+    size_t count = 0;
+    for (; x != 0; x &= x - 1)
+    {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * Calls @p convert for @p count elements and marks those it returns false for by set bits in
+ * @p errorMask, if it is given, which must have (count + 63) / 64 words.
+ * Failures of a word are gathered as bytes first, so that simple conversions vectorize,
+ * and then packed to bits 8 at a time.
+ * @return Number of elements not converted
+ */
+template<typename Convert>
+constexpr size_t convertMasked(size_t count, uint64_t* errorMask, Convert convert)
+{
+    size_t errors = 0;
+    for (size_t word = 0; word * 64 < count; ++word)
+    {
+        std::array<uint8_t, 64> failed{};
+        const size_t first = word * 64;
+        const size_t size = count - first < 64 ? count - first : 64;
+        for (size_t i = 0; i < size; ++i)
+        {
+            failed[i] = !convert(first + i);
+        }
+        uint64_t mask = 0;
+        for (size_t byte = 0; byte < 64; byte += 8)
+        {
+            uint64_t bytes = 0;
+            for (size_t i = 0; i < 8; ++i)
+            {
+                bytes |= uint64_t(failed[byte + i]) << (i * 8);
+            }
+            // Moves the lowest bit of byte i to bit 56 + i
+            mask |= ((bytes * 0x0102040810204080ull) >> 56) << byte;
+        }
+        if (errorMask != nullptr)
+        {
+            errorMask[word] = mask;
+        }
+        errors += popCount(mask);
+    }
+    return errors;
+}
+
+/// Integer written in decimal as whole @p text, nullopt if it is not one or is out of range of @p T
+template<typename T>
+constexpr std::optional<T> parseInteger(std::string_view text)
+{
+    if (!isConstantEvaluated())
+    {
+        T result{};
+        const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), result);
+        if (error != std::errc() || end != text.data() + text.size())
+            return std::nullopt;
+        return result;
+    }
+
+    using Unsigned = std::make_unsigned_t<T>;
+    const bool isNegative = std::is_signed_v<T> && !text.empty() && text[0] == '-';
+    if (isNegative)
+    {
+        text.remove_prefix(1);
+    }
+    if (text.empty())
+        return std::nullopt;
+    const auto limit = static_cast<Unsigned>(static_cast<Unsigned>(std::numeric_limits<T>::max()) + (isNegative ? 1 : 0));
+    Unsigned magnitude = 0;
+    for (const char c: text)
+    {
+        if (c < '0' || c > '9')
+            return std::nullopt;
+        const auto digit = static_cast<Unsigned>(c - '0');
+        if (magnitude > (limit - digit) / 10)
+            return std::nullopt;
+        magnitude = static_cast<Unsigned>(magnitude * 10 + digit);
+    }
+    return isNegative ? static_cast<T>(static_cast<Unsigned>(0 - magnitude)) : static_cast<T>(magnitude);
+}
+
+/// Bit per char of @p text, which has @p size of at most 64 chars, set if isIdentChar()
+constexpr uint64_t identMask(const char* text, size_t size)
+{
+    uint64_t mask = 0;
+#if defined(__AVX2__) || defined(__SSE2__)
+    if (size == 64 && !isConstantEvaluated())
+    {
+        // Letters are told by a signed compare after shifting 'a'-'z', or 'A'-'Z' made lowercase, to -128
+#if defined(__AVX2__)
+        for (size_t i = 0; i < 64; i += 32)
+        {
+            const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+            const __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+            const __m256i letters = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + 26)),
+                _mm256_add_epi8(lower, _mm256_set1_epi8(static_cast<char>(128 - 'a'))));
+            const __m256i digits = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(-128 + 10)),
+                _mm256_add_epi8(chars, _mm256_set1_epi8(static_cast<char>(128 - '0'))));
+            const __m256i underscores = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('_'));
+            const __m256i ident = _mm256_or_si256(_mm256_or_si256(letters, digits), underscores);
+            mask |= uint64_t(uint32_t(_mm256_movemask_epi8(ident))) << i;
+        }
+#else
+        for (size_t i = 0; i < 64; i += 16)
+        {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+            const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+            const __m128i letters = _mm_cmplt_epi8(_mm_add_epi8(lower, _mm_set1_epi8(static_cast<char>(128 - 'a'))),
+                _mm_set1_epi8(static_cast<char>(-128 + 26)));
+            const __m128i digits = _mm_cmplt_epi8(_mm_add_epi8(chars, _mm_set1_epi8(static_cast<char>(128 - '0'))),
+                _mm_set1_epi8(static_cast<char>(-128 + 10)));
+            const __m128i underscores = _mm_cmpeq_epi8(chars, _mm_set1_epi8('_'));
+            const __m128i ident = _mm_or_si128(_mm_or_si128(letters, digits), underscores);
+            mask |= uint64_t(uint16_t(_mm_movemask_epi8(ident))) << i;
+        }
+#endif
+        return mask;
+    }
+#endif
+    for (size_t i = 0; i < size; ++i)
+    {
+        mask |= uint64_t(identChars[static_cast<unsigned char>(text[i])]) << i;
+    }
+    return mask;
+}
+
+/**
+ * Name lookup of small enums. Length and one byte hash of every name are packed in two
+ * byte arrays and compared with the searched name at once using AVX2 or SSE2 (or one by
+ * one without them), names up to 8 bytes long are then confirmed by a single word compare.
+ */
+template<size_t N, bool = (N > 0 && N <= ENUM_INFO_SMALL_NAME_INDEX_MAX_SIZE)>
+struct SmallNameIndex
+{
+    static_assert(N <= 32, "SmallNameIndex supports up to 32 names");
+
+    static constexpr bool enabled = true;
+    static constexpr size_t paddedSize = N <= 16 ? 16 : 32;
+
+    template<typename Enum, size_t RawNamesSize>
+    constexpr SmallNameIndex(const ParsedData<Enum, N, RawNamesSize>& parsedData)
+        : lengths{}
+        , tags{}
+        , prefixes{}
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            const auto name = parsedData.name(i);
+            lengths[i] = static_cast<uint8_t>(name.size() < 255 ? name.size() : 255);
+            prefixes[i] = prefix(name);
+            tags[i] = tag(name, prefixes[i]);
+        }
+    }
+
+    static constexpr uint64_t prefix(std::string_view name)
+    {
+        return loadWord(name, 0, name.size() < 8 ? name.size() : 8);
+    }
+
+    static constexpr uint8_t tag(std::string_view name, uint64_t prefix)
+    {
+        const uint64_t suffix = name.size() > 8 ? loadWord(name, name.size() - 8, 8) : 0;
+        return static_cast<uint8_t>(((prefix ^ (suffix >> 1)) * 0x9E3779B97F4A7C15ull) >> 56);
+    }
+
+    template<typename Enum, size_t RawNamesSize>
+    std::optional<size_t> find(std::string_view name, const ParsedData<Enum, N, RawNamesSize>& parsedData) const
+    {
+        const uint64_t key = prefix(name);
+        for (uint32_t mask = candidates(name, key); mask != 0; mask &= mask - 1)
+        {
+            const size_t i = countTrailingZeros(mask);
+            if (name.size() <= 8 ? prefixes[i] == key : parsedData.name(i) == name)
+                return i;
+        }
+        return std::nullopt;
+    }
+
+    alignas(32) std::array<uint8_t, paddedSize> lengths;
+    alignas(32) std::array<uint8_t, paddedSize> tags;
+    std::array<uint64_t, N> prefixes;
+
+private:
+    /// Bit mask of indexes of names with same length and tag as @p name
+    uint32_t candidates(std::string_view name, uint64_t key) const
+    {
+        const auto length = static_cast<uint8_t>(name.size() < 255 ? name.size() : 255);
+        const auto nameTag = tag(name, key);
+        uint32_t mask = 0;
+#if defined(__AVX2__)
+        // Names fit in 16 bytes up to 16 of them, a 32 byte load would read past the arrays
+        if constexpr (paddedSize == 32)
+        {
+            const __m256i equal = _mm256_and_si256(
+                _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(lengths.data())),
+                                  _mm256_set1_epi8(static_cast<char>(length))),
+                _mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(tags.data())),
+                                  _mm256_set1_epi8(static_cast<char>(nameTag))));
+            mask = uint32_t(_mm256_movemask_epi8(equal));
+        }
+        else
+#endif
+        {
+#if defined(__SSE2__)
+            const __m128i lengthKeys = _mm_set1_epi8(static_cast<char>(length));
+            const __m128i tagKeys = _mm_set1_epi8(static_cast<char>(nameTag));
+            for (size_t i = 0; i < paddedSize; i += 16)
+            {
+                const __m128i equal = _mm_and_si128(
+                    _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(&lengths[i])), lengthKeys),
+                    _mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(&tags[i])), tagKeys));
+                mask |= uint32_t(_mm_movemask_epi8(equal)) << i;
+            }
+#else
+            for (size_t i = 0; i < N; ++i)
+            {
+                mask |= uint32_t(lengths[i] == length && tags[i] == nameTag) << i;
+            }
+#endif
+        }
+        // Padding may match an empty name
+        return N == 32 ? mask : mask & ((1u << N) - 1);
+    }
+};
+
+template<size_t N>
+struct SmallNameIndex<N, false>
+{
+    static constexpr bool enabled = false;
+
+    template<typename Enum, size_t RawNamesSize>
+    constexpr SmallNameIndex(const ParsedData<Enum, N, RawNamesSize>&) {}
+};
+
+/**
+ * Trie of names to parse them a char at a time. Nodes are prefixes of names numbered breadth
+ * first, so that children of a node are consecutive and sorted by their char. It is built with
+ * Capacity of one node per char of names and then copied to one of the size it takes.
+ */
+template<size_t N, size_t Capacity>
+struct NameTrie
+{
+    using Node = IndexType<Capacity>;
+
+    template<typename Enum, size_t RawNamesSize>
+    constexpr NameTrie(const ParsedData<Enum, N, RawNamesSize>& parsedData)
+        : size(0)
+        , chars{}
+        , childBegins{}
+        , names{}
+    {
+        std::array<IndexType<N>, N> sorted{};
+        for (size_t i = 0; i < N; ++i)
+        {
+            sorted[i] = static_cast<IndexType<N>>(i);
+        }
+        sort(sorted, [&parsedData](size_t l, size_t r)
+        {
+            return parsedData.name(l) < parsedData.name(r);
+        });
+
+        // Names with the prefix of a node are sorted[firsts[node], lasts[node])
+        std::array<IndexType<N>, Capacity> firsts{};
+        std::array<IndexType<N>, Capacity> lasts{};
+        lasts[0] = static_cast<IndexType<N>>(N);
+        size = 1;
+        for (size_t node = 0, depth = 0, levelEnd = 1; node < size; ++node)
+        {
+            if (node == levelEnd)
+            {
+                ++depth;
+                levelEnd = size;
+            }
+            childBegins[node] = static_cast<Node>(size);
+            names[node] = static_cast<IndexType<N>>(N);
+            size_t i = firsts[node];
+            // A name ending here is a prefix of the others, so it is sorted first
+            if (i < lasts[node] && parsedData.name(sorted[i]).size() == depth)
+            {
+                names[node] = sorted[i++];
+            }
+            while (i < lasts[node])
+            {
+                const char c = parsedData.name(sorted[i])[depth];
+                size_t last = i + 1;
+                while (last < lasts[node] && parsedData.name(sorted[last])[depth] == c)
+                {
+                    ++last;
+                }
+                chars[size] = c;
+                firsts[size] = static_cast<IndexType<N>>(i);
+                lasts[size] = static_cast<IndexType<N>>(last);
+                ++size;
+                i = last;
+            }
+        }
+        childBegins[size] = static_cast<Node>(size);
+    }
+
+    template<size_t OtherCapacity>
+    constexpr NameTrie(const NameTrie<N, OtherCapacity>& other)
+        : size(other.size)
+        , chars{}
+        , childBegins{}
+        , names{}
+    {
+        for (size_t node = 0; node < size; ++node)
+        {
+            chars[node] = other.chars[node];
+            childBegins[node] = static_cast<Node>(other.childBegins[node]);
+            names[node] = other.names[node];
+        }
+        childBegins[size] = static_cast<Node>(size);
+    }
+
+    /// Child of @p node by @p c, size if there is none
+    constexpr size_t child(size_t node, char c) const
+    {
+        size_t first = childBegins[node];
+        size_t count = childBegins[node + 1] - first;
+        while (count > 0)
+        {
+            const size_t step = count / 2;
+            if (chars[first + step] < c)
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+        return first < childBegins[node + 1] && chars[first] == c ? first : size;
+    }
+
+    size_t size;
+    std::array<char, Capacity> chars;           ///< Of the edge from the parent of a node
+    std::array<Node, Capacity + 1> childBegins; ///< Children of a node are [childBegins[node], childBegins[node + 1])
+    std::array<IndexType<N>, Capacity> names;   ///< Index of the name spelled by a node, N if none
+};
+
+/// Number of chars in names plus one, nodes a NameTrie takes at most
+template<typename Enum, size_t N, size_t RawNamesSize>
+constexpr size_t nameTrieCapacity(const ParsedData<Enum, N, RawNamesSize>& parsedData)
+{
+    size_t capacity = 1;
+    for (size_t i = 0; i < N; ++i)
+    {
+        capacity += parsedData.name(i).size();
+    }
+    return capacity;
+}
+
+/**
+ * Decomposition of flag values: index of the name of every single bit and indexes of
+ * multi-bit names, widest first so that they are preferred over single bits
+ */
+template<typename Enum, size_t N>
+struct FlagTables
+{
+    using Unsigned = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+    static constexpr size_t bitCount = std::numeric_limits<Unsigned>::digits;
+
+    static constexpr uint64_t bits(Enum value)
+    {
+        return static_cast<Unsigned>(value);
+    }
+
+    constexpr FlagTables(const std::array<Enum, N>& values)
+        : zeroIndex(N)
+        , bitIndexes{}
+        , composites{}
+        , compositeCount(0)
+    {
+        for (auto& index: bitIndexes)
+        {
+            index = static_cast<IndexType<N>>(N);
+        }
+        for (auto& index: composites)
+        {
+            index = static_cast<IndexType<N>>(N);
+        }
+        for (size_t i = 0; i < N; ++i)
+        {
+            const uint64_t valueBits = bits(values[i]);
+            if (valueBits == 0)
+            {
+                zeroIndex = zeroIndex == N ? i : zeroIndex;
+            }
+            else if (popCount(valueBits) == 1)
+            {
+                auto& index = bitIndexes[countTrailingZeros(valueBits)];
+                index = index == N ? static_cast<IndexType<N>>(i) : index;
+            }
+            else if (!hasComposite(values, valueBits))
+            {
+                composites[compositeCount++] = static_cast<IndexType<N>>(i);
+            }
+        }
+        sort(composites, [&values](IndexType<N> l, IndexType<N> r)
+        {
+            // Unused tail of N goes last
+            if (l == N || r == N)
+                return r == N && l != N;
+            const auto lCount = popCount(bits(values[l]));
+            const auto rCount = popCount(bits(values[r]));
+            return lCount > rCount || (lCount == rCount && l < r);
+        });
+    }
+
+    size_t zeroIndex;
+    std::array<IndexType<N>, bitCount> bitIndexes;
+    std::array<IndexType<N>, N> composites;
+    size_t compositeCount;
+
+private:
+    constexpr bool hasComposite(const std::array<Enum, N>& values, uint64_t valueBits) const
+    {
+        for (size_t i = 0; i < compositeCount; ++i)
+        {
+            if (bits(values[composites[i]]) == valueBits)
+                return true;
+        }
+        return false;
+    }
+};
+
+/// Compiler generated signature of this function, it names @p T
+template<typename T>
+constexpr auto signatureOf()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return std::string_view(__FUNCSIG__);
+#else
+    return std::string_view(__PRETTY_FUNCTION__);
+#endif
+}
+
+// Lengths of the signature before and after the type name, found in the signature naming int
+constexpr size_t typeNamePrefix = signatureOf<int>().rfind("int");
+constexpr size_t typeNameSuffix = signatureOf<int>().size() - typeNamePrefix - 3;
+
+/// Qualified name of @p T as spelled by the compiler, e.g. "ns::Cs::Color"
+template<typename T>
+constexpr std::string_view typeName()
+{
+    constexpr auto signature = signatureOf<T>();
+    auto name = signature.substr(typeNamePrefix, signature.size() - typeNamePrefix - typeNameSuffix);
+    constexpr std::string_view msvcEnumPrefix = "enum ";
+    if (name.substr(0, msvcEnumPrefix.size()) == msvcEnumPrefix)
+        name.remove_prefix(msvcEnumPrefix.size());
+    return name;
+}
+
+/// typeName() copied out of the signature, so that the binary keeps only the name
+template<typename T>
+struct QualifiedName
+{
+    static constexpr std::string_view name = typeName<T>();
+    static constexpr auto chars = []
+    {
+        std::array<char, name.size() + 1> chars{};
+        for (size_t i = 0; i < name.size(); ++i)
+        {
+            chars[i] = name[i];
+        }
+        return chars;
+    }();
+    static constexpr std::string_view value{chars.data(), name.size()};
+};
+
+/// Whether @p Enum is declared by ENUM_DECLARE or ENUM_DECLARE_NS
+template<typename Enum, typename = void>
+struct IsReflected : std::false_type {};
+
+template<typename Enum>
+struct IsReflected<Enum, std::void_t<decltype(getRawData(Enum()))>> : std::true_type {};
+
+#if ENUM_INFO_SCAN
+/// Compiler generated signature of this function, it names @p Value, or shows its number if it has no name
+template<typename Enum, Enum Value>
+constexpr auto valueSignatureOf()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return std::string_view(__FUNCSIG__);
+#else
+    return std::string_view(__PRETTY_FUNCTION__);
+#endif
+}
+
+enum class ScanProbe { Probe };
+
+// Length of the signature after the value name, found in the signature naming ScanProbe::Probe
+constexpr size_t valueNameSuffix = valueSignatureOf<ScanProbe, ScanProbe::Probe>().size()
+                                   - valueSignatureOf<ScanProbe, ScanProbe::Probe>().rfind("Probe") - 5;
+
+/// Name of @p Value without enclosing scopes, empty if @p Value names no enumerator
+template<typename Enum, Enum Value>
+constexpr std::string_view scannedName()
+{
+    constexpr auto signature = valueSignatureOf<Enum, Value>();
+    const size_t end = signature.size() - valueNameSuffix;
+    size_t begin = end;
+    while (begin > 0 && isIdentChar(signature[begin - 1]))
+    {
+        --begin;
+    }
+    // A value without name is shown as a cast number, e.g. "(Color)5"
+    if (begin == end || (signature[begin] >= '0' && signature[begin] <= '9'))
+        return {};
+    return signature.substr(begin, end - begin);
+}
+
+/// Names of values First, First + 1, ... First + Size - 1, instantiated once per chunk of ENUM_INFO_SCAN_CHUNK_SIZE
+template<typename Enum, int64_t First, size_t Size>
+struct ScanChunk
+{
+    template<size_t... I>
+    static constexpr std::array<std::string_view, Size> scan(std::index_sequence<I...>)
+    {
+        return {{scannedName<Enum, static_cast<Enum>(First + int64_t(I))>()...}};
+    }
+
+    static constexpr auto names = scan(std::make_index_sequence<Size>());
+};
+
+/**
+ * RawData of an enum not declared by ENUM_DECLARE or ENUM_DECLARE_NS: values of EnumScanRange
+ * which name an enumerator, in ascending order. Of several enumerators with one value only the
+ * name chosen by the compiler is found.
+ */
+template<typename Enum>
+struct ScannedEnum
+{
+    using EnumType = std::underlying_type_t<Enum>;
+
+    using Limits = std::numeric_limits<EnumType>;
+
+    // EnumScanRange clamped to the underlying type
+    static constexpr int64_t min = std::max<int64_t>(EnumScanRange<Enum>::min, int64_t(Limits::min()));
+    static constexpr int64_t max = EnumScanRange<Enum>::max > 0 && uint64_t(Limits::max()) < uint64_t(EnumScanRange<Enum>::max)
+                                   ? int64_t(Limits::max()) : EnumScanRange<Enum>::max;
+    static_assert(min <= max, "EnumScanRange is empty");
+    static constexpr size_t rangeSize = size_t(max - min + 1);
+    static constexpr size_t chunkSize = ENUM_INFO_SCAN_CHUNK_SIZE;
+
+    template<size_t... C>
+    static constexpr std::array<std::string_view, rangeSize> scan(std::index_sequence<C...>)
+    {
+        std::array<std::string_view, rangeSize> names{};
+        const auto copyChunk = [&names](size_t first, const auto& chunk)
+        {
+            for (size_t i = 0; i < chunk.size(); ++i)
+            {
+                names[first + i] = chunk[i];
+            }
+        };
+        (copyChunk(C * chunkSize,
+                   ScanChunk<Enum, min + int64_t(C * chunkSize), std::min(chunkSize, rangeSize - C * chunkSize)>::names), ...);
+        return names;
+    }
+
+    static constexpr auto names = scan(std::make_index_sequence<(rangeSize + chunkSize - 1) / chunkSize>());
+
+    static constexpr size_t count = []
+    {
+        size_t count = 0;
+        for (const auto name: names)
+        {
+            count += name.empty() ? 0 : 1;
+        }
+        return count;
+    }();
+    static_assert(count > 0, "No enumerators found in EnumScanRange, declare the enum by ENUM_DECLARE or ENUM_DECLARE_NS");
+
+    /// "(Name, Name, ...)" as parsed by ParsedData
+    static constexpr auto rawNames = []
+    {
+        constexpr size_t size = []
+        {
+            size_t size = 1 + 2 * count;
+            for (const auto name: names)
+            {
+                size += name.size();
+            }
+            return size;
+        }();
+        std::array<char, size + 1> rawNames{};
+        size_t offset = 0;
+        rawNames[offset++] = '(';
+        for (const auto name: names)
+        {
+            if (name.empty())
+                continue;
+            if (offset > 1)
+            {
+                rawNames[offset++] = ',';
+                rawNames[offset++] = ' ';
+            }
+            for (const char c: name)
+            {
+                rawNames[offset++] = c;
+            }
+        }
+        rawNames[offset++] = ')';
+        return rawNames;
+    }();
+
+    static constexpr auto values = []
+    {
+        std::array<Enum, count> values{};
+        for (size_t i = 0, value = 0; i < rangeSize; ++i)
+        {
+            if (!names[i].empty())
+                values[value++] = static_cast<Enum>(min + int64_t(i));
+        }
+        return values;
+    }();
+
+    template<size_t... I>
+    static constexpr RawData<Enum, count> makeRawData(std::index_sequence<I...>)
+    {
+        const EnumeratorValue<Enum> vals[] = {{}, values[I]...};
+        const auto name = QualifiedName<Enum>::value;
+        const auto scope = name.rfind("::");
+        return RawData<Enum, count>(scope == std::string_view::npos ? name : name.substr(scope + 2),
+                                    std::string_view(rawNames.data(), rawNames.size() - 1), vals);
+    }
+
+    static constexpr auto rawData = makeRawData(std::make_index_sequence<count>());
+};
+#endif
+
+/// RawData of @p Enum, from its ENUM_DECLARE or ENUM_DECLARE_NS or else scanned
+template<typename Enum>
+constexpr auto rawDataOf()
+{
+#if ENUM_INFO_SCAN
+    if constexpr (!IsReflected<Enum>::value)
+        return ScannedEnum<Enum>::rawData;
+    else
+#endif
+        return getRawData(Enum());
+}
+
+/// Name of @p value or its number when it has no name, @p buffer keeps the number
+template<typename Info, typename Enum, size_t Size>
+std::string_view nameOrNumber(Enum value, char (&buffer)[Size])
+{
+    if (const auto name = Info::valueName(value))
+        return *name;
+    const auto result = std::to_chars(buffer, buffer + Size, static_cast<std::underlying_type_t<Enum>>(value));
+    return std::string_view(buffer, size_t(result.ptr - buffer));
+}
+
+/**
+ * Calls @p F with the value as std::integral_constant, or @p Otherwise with values without name.
+ * A binary decision tree over offsets from min for dense enums or over sorted values for sparse
+ * ones ends in equality chains, which compilers turn into switches, so every handler is
+ * instantiated for its own value and inlined.
+ */
+template<typename Enum, typename R, typename F, typename Otherwise>
+struct Visitor
+{
+    using Info = EnumInfo<Enum, std::string_view>;
+    using Unsigned = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+
+    static constexpr size_t N = Info::_rawData._vals.size();
+    static constexpr size_t Range = denseRange(Info::_rawData._vals);
+
+    template<size_t Index>
+    static constexpr R visitValue(F& f, Otherwise&, Enum)
+    {
+        return f(std::integral_constant<Enum, Info::_rawData._vals[Index]>());
+    }
+
+    /// Position of @p value among positions searched: its offset from min if dense, itself if sparse
+    static constexpr auto key(Enum value)
+    {
+        if constexpr (Range > 0)
+            return static_cast<Unsigned>(static_cast<Unsigned>(value) - Info::_valueIndex.min);
+        else
+            return value;
+    }
+
+    template<size_t Position>
+    static constexpr auto keyAt()
+    {
+        if constexpr (Range > 0)
+            return static_cast<Unsigned>(Position);
+        else
+            return Info::_valueIndex.sortedValues[Position];
+    }
+
+    /// Search in positions [First, First + Count): equality chains in leaves, which compilers turn into switches
+    template<size_t First, size_t Count, typename Key>
+    static constexpr R search(F& f, Otherwise& otherwise, Enum value, Key key)
+    {
+        if constexpr (Count <= 8)
+        {
+            if (key == keyAt<First>())
+            {
+                if constexpr (Info::_valueIndex.indexes[First] == N)
+                    return otherwise(value);
+                else
+                    return visitValue<Info::_valueIndex.indexes[First]>(f, otherwise, value);
+            }
+            if constexpr (Count > 1)
+                return search<First + 1, Count - 1>(f, otherwise, value, key);
+            else
+                return otherwise(value);
+        }
+        else
+        {
+            constexpr size_t half = Count / 2;
+            if (key < keyAt<First + half>())
+                return search<First, half>(f, otherwise, value, key);
+            return search<First + half, Count - half>(f, otherwise, value, key);
+        }
+    }
+
+    static constexpr R visit(F& f, Otherwise& otherwise, Enum value)
+    {
+        static_assert(N > 0, "Enum has no values to visit");
+        return search<0, (Range > 0 ? Range : N)>(f, otherwise, value, key(value));
+    }
+};
+
+} // namespace _enum_info_private
+
+// ---- Lookup statistics ----
+
+/// Lookups counted by EnumLookupStats, batch conversions like values(names, count, ...) count none
+enum class EnumLookup
+{
+    ByValue,        ///< index(Enum), fromUnderlying() and what is built on them: valueName(Enum), isValid(), ...
+    ByIndex,        ///< value(size_t) and valueName(size_t)
+    ByName,         ///< index(std::string_view) and value(std::string_view)
+    ByFoldedName,   ///< index(name, fold), value(name, fold) and valueCaseInsensitive()
+};
+
+#if ENUM_INFO_STATS
+/**
+ * Lookup counters of an enum, collected when ENUM_INFO_STATS is 1. An enum is registered on its
+ * first lookup at run time, first() and next() walk the registered enums, dump() prints them.
+ * Counters are relaxed atomics, so they are exact but not synchronized with each other.
+ */
+class alignas(64) EnumLookupStats
+{
+public:
+    static constexpr size_t lookupCount = 4;
+    /// Bucket i counts lookups taken less than 2^i ns, the last one also all slower lookups
+    static constexpr size_t latencyBucketCount = 16;
+
+    constexpr explicit EnumLookupStats(std::string_view enumName) : _enumName(enumName) {}
+    EnumLookupStats(const EnumLookupStats&) = delete;
+    EnumLookupStats& operator=(const EnumLookupStats&) = delete;
+
+    std::string_view enumName() const { return _enumName; }
+    uint64_t calls(EnumLookup lookup) const;
+    uint64_t misses(EnumLookup lookup) const;
+    uint64_t latencies(EnumLookup lookup, size_t bucket) const;
+    void reset();
+
+    static const EnumLookupStats* first();
+    const EnumLookupStats* next() const;
+    static void dump(std::ostream& out);
+
+    /// Runs @p func, which returns an optional, and counts it as @p lookup
+    template<typename Func>
+    auto measure(EnumLookup lookup, Func func);
+
+private:
+    struct Counters
+    {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> misses{0};
+#if ENUM_INFO_STATS_LATENCY
+        std::array<std::atomic<uint64_t>, latencyBucketCount> latencies{};
+#endif
+    };
+
+    void add(EnumLookup lookup, bool isHit, uint64_t nanoseconds);
+
+    static inline std::atomic<const EnumLookupStats*> _first{nullptr};
+
+    std::string_view _enumName;
+    std::array<Counters, lookupCount> _counters{};
+    std::atomic<bool> _isRegistered{false};
+    const EnumLookupStats* _next = nullptr;
+};
+#endif
+
+namespace _enum_info_private
+{
+
+#if ENUM_INFO_STATS
+template<typename Enum>
+struct LookupStatsOf
+{
+    static inline EnumLookupStats stats{EnumInfo<Enum, std::string_view>::qualifiedName()};
+};
+#endif
+
+/// Runs @p func, counting it as @p lookup of @p Enum at run time when ENUM_INFO_STATS is 1
+template<typename Enum, typename Func>
+constexpr auto recordLookup([[maybe_unused]] EnumLookup lookup, Func func)
+{
+#if ENUM_INFO_STATS
+    if (!isConstantEvaluated())
+        return LookupStatsOf<Enum>::stats.measure(lookup, func);
+#endif
+    return func();
+}
+
+} // namespace _enum_info_private
+
+// ---- Registry ----
+
+#if ENUM_INFO_REGISTRY
+/**
+ * Enums declared by ENUM_DECLARE or ENUM_DECLARE_NS, looked up by EnumInfo::qualifiedName() or
+ * EnumInfo::typeHash() at run time, when ENUM_INFO_REGISTRY is 1. Enums register themselves during
+ * static initialization. The first lookup builds indexes of names and hashes sorted for binary
+ * search, they are rebuilt only if more enums register later, e.g. from a shared library.
+ * Lookups never lock once the indexes are built.
+ */
+class EnumRegistry
+{
+public:
+    /// Type-erased EnumInfo of one enum, values are converted to and from int64_t
+    struct Entry
+    {
+        std::string_view qualifiedName;
+        uint64_t typeHash;
+        size_t size;
+        std::optional<int64_t> (*value)(std::string_view valueName);
+        std::optional<std::string_view> (*valueName)(int64_t value);
+        const Entry* next;
+    };
+
+    static const Entry* find(std::string_view qualifiedName);
+    static const Entry* find(uint64_t typeHash);
+    static std::optional<int64_t> lookupValue(std::string_view qualifiedName, std::string_view valueName);
+    static std::optional<int64_t> lookupValue(uint64_t typeHash, std::string_view valueName);
+    static std::optional<std::string_view> lookupValueName(std::string_view qualifiedName, int64_t value);
+    static std::optional<std::string_view> lookupValueName(uint64_t typeHash, int64_t value);
+    static size_t size();
+
+    static void add(Entry& entry);
+
+private:
+    struct Index
+    {
+        std::vector<const Entry*> entries; ///< Sorted by name
+        std::vector<const Entry*> hashed;  ///< Sorted by hash
+        size_t registeredCount;
+        const Index* previous;             ///< Replaced indexes are kept for lookups still reading them
+    };
+
+    static const Index& index();
+
+    static inline std::atomic<const Entry*> _first{nullptr};
+    static inline std::atomic<size_t> _registeredCount{0};
+    static inline std::atomic<const Index*> _index{nullptr};
+    static inline std::mutex _indexMutex;
+};
+
+namespace _enum_info_private
+{
+
+template<typename Enum>
+std::optional<int64_t> registryValue(std::string_view valueName)
+{
+    const auto value = EnumInfo<Enum, std::string_view>::value(valueName);
+    if (!value.has_value())
+        return std::nullopt;
+    return static_cast<int64_t>(static_cast<std::underlying_type_t<Enum>>(*value));
+}
+
+template<typename Enum>
+std::optional<std::string_view> registryValueName(int64_t value)
+{
+    using EnumType = std::underlying_type_t<Enum>;
+    if (static_cast<int64_t>(static_cast<EnumType>(value)) != value)
+        return std::nullopt;
+    return EnumInfo<Enum, std::string_view>::valueName(static_cast<Enum>(static_cast<EnumType>(value)));
+}
+
+template<typename Enum>
+struct RegistryEntryOf
+{
+    static inline EnumRegistry::Entry entry{EnumInfo<Enum, std::string_view>::qualifiedName(),
+                                            EnumInfo<Enum, std::string_view>::typeHash(),
+                                            EnumInfo<Enum, std::string_view>::size(),
+                                            &registryValue<Enum>, &registryValueName<Enum>, nullptr};
+};
+
+template<typename Enum>
+bool registerEnum()
+{
+    EnumRegistry::add(RegistryEntryOf<Enum>::entry);
+    return true;
+}
+
+} // namespace _enum_info_private
+
+#define ENUM_INFO_DETAIL_REGISTER_namespace(enumName) \
+    inline const bool _enum_info_isRegistered_##enumName = _enum_info_private::registerEnum<enumName>();
+#define ENUM_INFO_DETAIL_REGISTER_class(enumName) \
+    static inline const bool _enum_info_isRegistered_##enumName = _enum_info_private::registerEnum<enumName>();
+#else
+#define ENUM_INFO_DETAIL_REGISTER_namespace(enumName)
+#define ENUM_INFO_DETAIL_REGISTER_class(enumName)
+#endif
+
+/**
+ * @brief Declare an enumeration inside a class
+ * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
+ * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
+ */
+#define ENUM_DECLARE( enumName, enumType, ... )\
+                              ENUM_INFO_DETAIL_MAKE( class, enumName, enumType, __VA_ARGS__ )
+
+/**
+ * @brief Declare an enumeration inside a namespace
+ * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
+ * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
+ */
+#define ENUM_DECLARE_NS( enumName, enumType, ... )\
+                              ENUM_INFO_DETAIL_MAKE( namespace, enumName, enumType, __VA_ARGS__ )
+
+/**
+ * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
+ * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
+ */
+#define ENUM_INFO_DETAIL_SPEC_namespace \
+    extern "C"{/* Protection from being used inside a class body */} \
+    inline
+
+/**
+ * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
+ * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
+ */
+#define ENUM_INFO_DETAIL_SPEC_class friend
+
+/**
+ * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
+ * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
+ */
+#define ENUM_INFO_DETAIL_STR(x) #x
+
+/**
+ * The enumerator list is expanded three times, as the enum, as the adaptors naming its
+ * enumerators and as the values resolved in declaration order, and stringized once for the
+ * names. Each use is needed. For 5000 entries with GCC 12 -O2, all of getRawData() takes 0.39 s
+ * of the 3.4 s over the header alone, the plain enum 0.04 s. The rest is building lookup tables.
+ * @author Yakov Litvitskiy <thedsi100@gmail.com> (c) 2016
+ * <a href="https://github.com/thedsi/EnumReflection/blob/master/LICENSE.txt">LICENSE.txt</a>
+ */
+#define ENUM_INFO_DETAIL_MAKE(spec, enumName, enumType, ...)                                    \
+    enum enumName:enumType                                                                      \
+    {                                                                                           \
+        __VA_ARGS__                                                                             \
+    };                                                                                          \
+    ENUM_INFO_DETAIL_SPEC_##spec                                                                \
+    constexpr auto getRawData(enumName = enumName())                                            \
+    {                                                                                           \
+        _enum_info_private::Adaptor<enumName> __VA_ARGS__;                                      \
+        const _enum_info_private::EnumeratorValue<enumName> vals[] = { {}, __VA_ARGS__ };       \
+        return _enum_info_private::RawData<enumName, sizeof(vals)/sizeof(*vals) - 1>(           \
+            ENUM_INFO_DETAIL_STR(enumName), ENUM_INFO_DETAIL_STR((__VA_ARGS__)), vals);         \
+    }                                                                                           \
+    ENUM_INFO_DETAIL_REGISTER_##spec(enumName)
+
+template<typename Enum, typename String = std::string_view>
+class EnumInfo
+{
+    // All reflection data is constant-initialized, so there is neither dynamic initialization
+    // order to depend on nor shared state to synchronize between threads
+    static constexpr auto _rawData = _enum_info_private::rawDataOf<Enum>();
+
+public:
+    using EnumType = std::underlying_type_t<Enum>;
+
+    static constexpr String   name();
+    static constexpr String   qualifiedName();
+    static constexpr uint64_t typeHash();
+    static constexpr size_t   size();
+    static constexpr size_t   dataSize();
+#if ENUM_INFO_STATS
+    static EnumLookupStats&   lookupStats();
+#endif
+
+    static constexpr std::optional<String>    valueName(Enum value);
+    static constexpr std::optional<String>    valueName(size_t index);
+    static constexpr std::optional<Enum>      value(std::string_view name);
+    template<typename Fold>
+    static constexpr std::optional<Enum>      value(std::string_view name, Fold fold);
+    static constexpr std::optional<Enum>      valueCaseInsensitive(std::string_view name);
+    static constexpr std::optional<Enum>      value(size_t index);
+    static constexpr std::optional<size_t>    index(Enum value);
+    static constexpr std::optional<size_t>    index(std::string_view name);
+    template<typename Fold>
+    static constexpr std::optional<size_t>    index(std::string_view name, Fold fold);
+    static constexpr bool                     isValid(EnumType value);
+    static constexpr std::optional<Enum>      fromUnderlying(EnumType value);
+    static constexpr std::optional<Enum>      valueOrNumber(std::string_view text);
+
+    class NameRange;
+    static constexpr NameRange                valueNames(Enum value);
+    static constexpr bool                     isAlias(size_t index);
+    static constexpr std::optional<size_t>    canonicalIndex(size_t index);
+
+    template<typename OutputIt>
+    static constexpr std::optional<OutputIt>  appendName(Enum value, OutputIt out);
+    static constexpr std::optional<size_t>    writeName(Enum value, char* buffer, size_t capacity);
+
+    static constexpr size_t valueNames(const Enum* values, size_t count, String* names);
+    static constexpr size_t values(const std::string_view* names, size_t count, Enum* values, uint64_t* errorMask = nullptr);
+    static constexpr size_t validate(const EnumType* values, size_t count, uint64_t* errorMask = nullptr);
+#if defined(__cpp_lib_span)
+    static constexpr size_t valueNames(std::span<const Enum> values, std::span<String> names);
+    static constexpr size_t values(std::span<const std::string_view> names, std::span<Enum> values, std::span<uint64_t> errorMask = {});
+    static constexpr size_t validate(std::span<const EnumType> values, std::span<uint64_t> errorMask = {});
+#endif
+
+    /// Compact wire form of values: their index in the smallest unsigned type able to hold it
+    using Code = _enum_info_private::CodeType<_rawData._vals.size()>;
+    static constexpr std::optional<Code>      encode(Enum value);
+    static constexpr std::optional<Enum>      decode(Code code);
+    static constexpr size_t encode(const Enum* values, size_t count, Code* codes, uint64_t* errorMask = nullptr);
+    static constexpr size_t decode(const Code* codes, size_t count, Enum* values, uint64_t* errorMask = nullptr);
+#if defined(__cpp_lib_span)
+    static constexpr size_t encode(std::span<const Enum> values, std::span<Code> codes, std::span<uint64_t> errorMask = {});
+    static constexpr size_t decode(std::span<const Code> codes, std::span<Enum> values, std::span<uint64_t> errorMask = {});
+#endif
+    static constexpr uint64_t                 fingerprint();
+
+    template<typename F>
+    static constexpr auto                     visit(Enum value, F&& f);
+    template<typename F, typename Otherwise>
+    static constexpr decltype(auto)           visit(Enum value, F&& f, Otherwise&& otherwise);
+    static constexpr EnumNameScanner<Enum>    scanner();
+
+    /**
+     * Random access over entries in declaration order, an entry is the iterator itself. Entries
+     * are returned by value, which C++17 forward iterators don't allow, so like std::ranges::iota_view
+     * it is an input iterator to iterator_traits and random access to C++20 concepts.
+     */
+    struct iterator
+    {
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type  = iterator;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = iterator; ///< Entries are returned by value, so reverse_iterator never dangles
+
+        constexpr iterator() = default;
+
+        constexpr size_t index() const;
+        constexpr Enum value() const;
+        constexpr String name() const;
+
+        constexpr value_type      operator*() const;
+        constexpr value_type      operator[](difference_type) const;
+        constexpr iterator&       operator++();
+        constexpr iterator        operator++(int);
+        constexpr iterator&       operator--();
+        constexpr iterator        operator--(int);
+        constexpr iterator&       operator+=(difference_type);
+        constexpr iterator&       operator-=(difference_type);
+        constexpr iterator        operator+(difference_type) const;
+        constexpr iterator        operator-(difference_type) const;
+        constexpr difference_type operator-(iterator) const;
+        constexpr bool            operator==(iterator) const;
+        constexpr bool            operator!=(iterator) const;
+        constexpr bool            operator<(iterator) const;
+        constexpr bool            operator>(iterator) const;
+        constexpr bool            operator<=(iterator) const;
+        constexpr bool            operator>=(iterator) const;
+
+        friend constexpr iterator operator+(difference_type offset, iterator it) { return it + offset; }
+
+    private:
+        friend EnumInfo;
+        constexpr explicit iterator(size_t index);
+
+        size_t _index = 0;
+    };
+
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    class Parser;
+
+    /// Names of a value, the canonical one first and then its aliases in declaration order
+    class NameRange
+    {
+        using Index = _enum_info_private::IndexType<_rawData._vals.size()>;
+
+    public:
+        struct iterator
+        {
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = String;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = String;
+
+            constexpr size_t index() const;
+
+            constexpr String    operator*() const;
+            constexpr iterator& operator++();
+            constexpr iterator  operator++(int);
+            constexpr bool      operator==(iterator) const;
+            constexpr bool      operator!=(iterator) const;
+
+        private:
+            friend NameRange;
+            constexpr iterator(const Index* grouped, size_t position);
+
+            const Index* _grouped; ///< nullptr if positions are indexes
+            size_t _position;
+        };
+
+        constexpr iterator begin() const;
+        constexpr iterator end() const;
+        constexpr size_t size() const;
+        constexpr bool empty() const;
+
+    private:
+        friend EnumInfo;
+        constexpr NameRange(const Index* grouped, size_t first, size_t last);
+
+        const Index* _grouped;
+        size_t _first;
+        size_t _last;
+    };
+
+    static constexpr iterator begin();
+    static constexpr iterator end();
+
+    static constexpr reverse_iterator rbegin();
+    static constexpr reverse_iterator rend();
+
+private:
+    template<typename>
+    friend class FlagInfo;
+    template<typename, typename>
+    friend class EnumMap;
+    template<typename>
+    friend class EnumSet;
+    template<typename, typename, typename, typename>
+    friend struct _enum_info_private::Visitor;
+
+    template<typename>
+    friend class EnumNameScanner;
+    friend class Parser;
+
+    static constexpr bool isDeclared(EnumType value);
+    static constexpr std::optional<size_t> findName(std::string_view name);
+
+    static constexpr _enum_info_private::ParsedData<Enum, _rawData._vals.size(), _rawData._rawNamesSize> _parsedData{_rawData};
+    static constexpr _enum_info_private::ValueIndex<Enum, _rawData._vals.size(),
+                                                    _enum_info_private::denseRange(_rawData._vals)> _valueIndex{_rawData._vals};
+    static constexpr _enum_info_private::NameIndex<_rawData._vals.size()> _nameIndex{_parsedData};
+    static constexpr _enum_info_private::SmallNameIndex<_rawData._vals.size()> _smallNameIndex{_parsedData};
+    static constexpr _enum_info_private::AliasIndex<_rawData._vals.size(),
+                                                    _valueIndex.hasAliases()> _aliasIndex{_rawData._vals, _valueIndex};
+    // Built on first use of a Fold
+    template<typename Fold>
+    static constexpr _enum_info_private::NameIndex<_rawData._vals.size(), _enum_info_private::FoldedName<Fold>>
+        _foldedNameIndex{_parsedData};
+};
+
+/**
+ * Converts values of flag enums declared by ENUM_DECLARE or ENUM_DECLARE_NS to and from
+ * names of their flags joined by '|', e.g. "Salted|Sweet". Names of several bits, like
+ * "SourSweet", are preferred over names of single bits.
+ */
+template<typename Enum>
+class FlagInfo
+{
+public:
+    static constexpr char separator = '|';
+
+    template<typename OutputIt>
+    static constexpr std::optional<OutputIt>    format(Enum value, OutputIt out);
+    static constexpr std::optional<size_t>      format(Enum value, char* buffer, size_t capacity);
+    static constexpr std::optional<size_t>      formattedSize(Enum value);
+    static std::optional<std::string>           toString(Enum value);
+    static constexpr std::optional<Enum>        parse(std::string_view names);
+
+private:
+    using Info = EnumInfo<Enum>;
+    using Tables = _enum_info_private::FlagTables<Enum, Info::_rawData._vals.size()>;
+
+    static constexpr Tables _tables{Info::_rawData._vals};
+
+    template<typename Visitor>
+    static constexpr bool decompose(Enum value, Visitor visit);
+};
+
+/**
+ * Map from values of an enum to @p T kept in an array indexed by EnumInfo::index(), so that it
+ * neither hashes nor allocates. Every value has a slot, aliases share the slot of their value,
+ * values without name have none. Iteration is in declaration order and skips aliases.
+ */
+template<typename Enum, typename T>
+class EnumMap
+{
+    using Info = EnumInfo<Enum>;
+
+public:
+    using key_type = Enum;
+    using mapped_type = T;
+
+    /// Forward iteration over (value, mapped) pairs, the mapped one is a reference
+    template<bool IsConst>
+    struct Iterator
+    {
+        using Mapped = std::conditional_t<IsConst, const T, T>;
+
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<Enum, Mapped&>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        constexpr value_type operator*() const;
+        constexpr Iterator&  operator++();
+        constexpr Iterator   operator++(int);
+        constexpr bool       operator==(Iterator) const;
+        constexpr bool       operator!=(Iterator) const;
+
+    private:
+        friend EnumMap;
+        constexpr Iterator(Mapped* values, size_t index);
+
+        Mapped* _values;
+        size_t _index;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    constexpr EnumMap() = default;
+    constexpr EnumMap(std::initializer_list<std::pair<Enum, T>> entries);
+
+    constexpr T&       operator[](Enum key);
+    constexpr const T& operator[](Enum key) const;
+    constexpr T&       at(Enum key);
+    constexpr const T& at(Enum key) const;
+    constexpr T*       find(Enum key);
+    constexpr const T* find(Enum key) const;
+
+    static constexpr size_t size();
+    constexpr void fill(const T& value);
+
+    constexpr iterator       begin();
+    constexpr iterator       end();
+    constexpr const_iterator begin() const;
+    constexpr const_iterator end() const;
+
+    constexpr bool operator==(const EnumMap& other) const;
+    constexpr bool operator!=(const EnumMap& other) const;
+
+private:
+    static constexpr size_t nextCanonical(size_t index);
+    static constexpr size_t slot(Enum key);
+
+    std::array<T, Info::size()> _values{};
+};
+
+/**
+ * Set of values of an enum as a bitset indexed by EnumInfo::index(), set operations go over
+ * 64 bit words in plain loops the compiler vectorizes. Iteration is in declaration order,
+ * aliases are contained along with their value, values without name are never contained.
+ */
+template<typename Enum>
+class EnumSet
+{
+    using Info = EnumInfo<Enum>;
+    static constexpr size_t wordCount = (Info::size() + 63) / 64;
+
+public:
+    using key_type = Enum;
+    using value_type = Enum;
+
+    /// Forward iteration over contained values
+    struct iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Enum;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Enum;
+
+        constexpr Enum      operator*() const;
+        constexpr iterator& operator++();
+        constexpr iterator  operator++(int);
+        constexpr bool      operator==(iterator) const;
+        constexpr bool      operator!=(iterator) const;
+
+    private:
+        friend EnumSet;
+        constexpr iterator(const uint64_t* words, size_t index);
+
+        const uint64_t* _words;
+        size_t _index;
+    };
+
+    constexpr EnumSet() = default;
+    constexpr EnumSet(std::initializer_list<Enum> values);
+    static constexpr EnumSet all();
+
+    constexpr bool   insert(Enum value);
+    constexpr size_t erase(Enum value);
+    constexpr bool   contains(Enum value) const;
+    constexpr size_t size() const;
+    constexpr bool   empty() const;
+    constexpr void   clear();
+
+    constexpr EnumSet& operator|=(const EnumSet& other);
+    constexpr EnumSet& operator&=(const EnumSet& other);
+    constexpr EnumSet& operator-=(const EnumSet& other);
+    constexpr EnumSet  operator|(const EnumSet& other) const;
+    constexpr EnumSet  operator&(const EnumSet& other) const;
+    constexpr EnumSet  operator-(const EnumSet& other) const;
+    constexpr bool     operator==(const EnumSet& other) const;
+    constexpr bool     operator!=(const EnumSet& other) const;
+
+    constexpr iterator begin() const;
+    constexpr iterator end() const;
+
+private:
+    static constexpr size_t next(const uint64_t* words, size_t index);
+
+    std::array<uint64_t, wordCount> _words{};
+};
+
+/**
+ * Finds names of an enum in text streamed in chunks of any size, in a single pass. Names match
+ * whole identifiers only, delimited by isIdentChar() like in ENUM_DECLARE, so that "HTTPS" is not
+ * found in "HTTPS2". Identifiers of a length some name has are looked up by the perfect hash.
+ */
+template<typename Enum>
+class EnumNameScanner
+{
+    using Info = EnumInfo<Enum>;
+
+public:
+    /// Name found: offset of its first char from the start of the stream and its value
+    struct Match
+    {
+        size_t offset;
+        Enum value;
+    };
+
+    template<typename OnMatch>
+    constexpr void scan(std::string_view text, OnMatch onMatch);
+    template<typename OnMatch>
+    constexpr void finish(OnMatch onMatch);
+    constexpr void count(std::string_view text, EnumMap<Enum, size_t>& counts);
+    constexpr void finish(EnumMap<Enum, size_t>& counts);
+
+private:
+    static constexpr size_t maxNameSize();
+    static constexpr uint64_t nameSizes();
+    static constexpr bool mayBeName(size_t size);
+
+    template<typename OnMatch>
+    constexpr void match(std::string_view identifier, size_t offset, OnMatch& onMatch) const;
+
+    size_t _offset = 0;         ///< Of the next text in the stream
+    size_t _pendingSize = 0;    ///< Of the identifier at the end of the previous text, maxNameSize() + 1 if longer
+    std::array<char, maxNameSize()> _pending{};
+};
+
+/**
+ * Parses a name arriving in chunks, e.g. split across network segments, without copying them
+ * together. The name ends at a char which is not isIdentChar() or at finish(). Between calls
+ * the only state is a small integer: a node of a trie of names or what was decided.
+ */
+template<typename Enum, typename String>
+class EnumInfo<Enum, String>::Parser
+{
+public:
+    enum class Result : uint8_t
+    {
+        NeedMore,   ///< Chars so far begin some name
+        Match,      ///< Chars so far are a name and it has ended
+        NoMatch,    ///< No name begins with chars so far or they ended before one was complete
+    };
+
+    constexpr Result parse(std::string_view& input);
+    constexpr Result finish();
+    constexpr Result result() const;
+    constexpr std::optional<Enum> value() const;
+    constexpr void reset();
+
+private:
+    static constexpr _enum_info_private::NameTrie<_rawData._vals.size(), _enum_info_private::nameTrieCapacity(_parsedData)>
+        _fullTrie{_parsedData};
+    static constexpr _enum_info_private::NameTrie<_rawData._vals.size(), _fullTrie.size> _trie{_fullTrie};
+
+    /// State after the name ended at @p node
+    static constexpr size_t ended(size_t node);
+
+    /// Nodes in progress, then no match, then a match of each name
+    _enum_info_private::IndexType<_trie.size + 1 + _rawData._vals.size()> _state = 0;
+};
+
+// ---- EnumInfo implementation ----
+
+template<typename Enum, typename String>
+constexpr String EnumInfo<Enum, String>::name()
+{
+    return String(_parsedData.enumName);
+}
+
+template<typename Enum, typename String>
+constexpr std::optional<String> EnumInfo<Enum, String>::valueName(Enum value)
+{
+    const auto i = index(value);
+    if (!i.has_value())
+        return std::nullopt;
+    return String(_parsedData.name(*i));
+}
+
+template<typename Enum, typename String>
+constexpr std::optional<String> EnumInfo<Enum, String>::valueName(size_t index)
+{
+    return _enum_info_private::recordLookup<Enum>(EnumLookup::ByIndex, [index]() -> std::optional<String>
+    {
+        if (index >= size())
+            return std::nullopt;
+        return String(_parsedData.name(index));
+    });
+}
+
+template<typename Enum, typename String>
+constexpr std::optional<Enum> EnumInfo<Enum, String>::value(std::string_view name)
+{
+    const auto i = index(name);
+    if (!i.has_value())
+        return std::nullopt;
+    return _parsedData.values[*i];
+}
+
+/// Value whose name equals @p name after folding both by @p fold, e.g. IgnoreCase
+template<typename Enum, typename String>
+template<typename Fold>
+constexpr std::optional<Enum> EnumInfo<Enum, String>::value(std::string_view name, Fold fold)
+{
+    const auto i = index(name, fold);
+    if (!i.has_value())
+        return std::nullopt;
+    return _parsedData.values[*i];
+}
+
+template<typename Enum, typename String>
+constexpr std::optional<Enum> EnumInfo<Enum, String>::valueCaseInsensitive(std::string_view name)
+{
+    return value(name, IgnoreCase());
+}
+
+template<typename Enum, typename String>
+constexpr std::optional<Enum> EnumInfo<Enum, String>::value(size_t index)
+{
+    return _enum_info_private::recordLookup<Enum>(EnumLookup::ByIndex, [index]() -> std::optional<Enum>
+    {
+        if (index >= size())
+            return std::nullopt;
+        return _parsedData.values[index];
+    });
+}
+
+template<typename Enum, typename String>
+constexpr std::optional<size_t> EnumInfo<Enum, String>::index(Enum value)
+{
+    return _enum_info_private::recordLookup<Enum>(EnumLookup::ByValue, [value]
+    {
+        return _valueIndex.find(value);
+    });
+}
+
+/// Whether @p value is a value with name, e.g. an integer received from elsewhere
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::isValid(EnumType value)
+{
+    return fromUnderlying(value).has_value();
+}
+
+/// @p value as Enum, nullopt if it has no name
+template<typename Enum, typename String>
+constexpr std::optional<Enum> EnumInfo<Enum, String>::fromUnderlying(EnumType value)
+{
+    return _enum_info_private::recordLookup<Enum>(EnumLookup::ByValue, [value]() -> std::optional<Enum>
+    {
+        if (!isDeclared(value))
+            return std::nullopt;
+        return static_cast<Enum>(value);
+    });
+}
+
+/// Value named @p text or, failing that, written in decimal as @p text, e.g. "443", if it has a name
+template<typename Enum, typename String>
+constexpr std::optional<Enum> EnumInfo<Enum, String>::valueOrNumber(std::string_view text)
+{
+    if (const auto named = value(text))
+        return named;
+    const auto number = _enum_info_private::parseInteger<EnumType>(text);
+    if (!number.has_value())
+        return std::nullopt;
+    return fromUnderlying(*number);
+}
+
+/// Whether @p value has a name: a range check if values are contiguous, else a value index lookup
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::isDeclared(EnumType value)
+{
+    constexpr bool isContiguous = size() > 0
+                                  && _enum_info_private::denseRange(_rawData._vals) == size()
+                                  && !_valueIndex.hasAliases();
+    if constexpr (isContiguous)
+    {
+        using Unsigned = std::make_unsigned_t<EnumType>;
+        return static_cast<Unsigned>(static_cast<Unsigned>(value) - _valueIndex.min) < size();
+    }
+    else
+    {
+        return _valueIndex.find(static_cast<Enum>(value)).has_value();
+    }
+}
+
+template<typename Enum, typename String>
+constexpr std::optional<size_t> EnumInfo<Enum, String>::index(std::string_view name)
+{
+    return _enum_info_private::recordLookup<Enum>(EnumLookup::ByName, [name]
+    {
+        return findName(name);
+    });
+}
+
+template<typename Enum, typename String>
+constexpr std::optional<size_t> EnumInfo<Enum, String>::findName(std::string_view name)
+{
+    if (size() == 0)
+        return std::nullopt;
+
+    if constexpr (_smallNameIndex.enabled)
+    {
+        if (!_enum_info_private::isConstantEvaluated())
+            return _smallNameIndex.find(name, _parsedData);
+    }
+
+    const size_t i = _nameIndex.candidate(name);
+    if (i == size() || _parsedData.name(i) != name)
+        return std::nullopt;
+    return i;
+}
+
+template<typename Enum, typename String>
+template<typename Fold>
+constexpr std::optional<size_t> EnumInfo<Enum, String>::index(std::string_view name, Fold)
+{
+    return _enum_info_private::recordLookup<Enum>(EnumLookup::ByFoldedName, [name]() -> std::optional<size_t>
+    {
+        if (size() == 0)
+            return std::nullopt;
+
+        const size_t i = _foldedNameIndex<Fold>.candidate(name);
+        if (i == size() || !_enum_info_private::FoldedName<Fold>::equal(_parsedData.name(i), name))
+            return std::nullopt;
+        return i;
+    });
+}
+
+/// Name with enclosing namespaces and classes, e.g. "ns::Cs::Color", as spelled by the compiler
+template<typename Enum, typename String>
+constexpr String EnumInfo<Enum, String>::qualifiedName()
+{
+    return String(_enum_info_private::QualifiedName<Enum>::value);
+}
+
+/// 64-bit hash of qualifiedName(), the same for every build by one compiler
+template<typename Enum, typename String>
+constexpr uint64_t EnumInfo<Enum, String>::typeHash()
+{
+    return _enum_info_private::hashName<>(_enum_info_private::QualifiedName<Enum>::value, 0);
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::size()
+{
+    return _parsedData.values.size();
+}
+
+/// Bytes of static data behind the enum reflection, names included, nothing is allocated on heap
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::dataSize()
+{
+    const size_t names = _rawData._enumNameSize + 1 + _rawData._rawNamesSize + 1;
+    const size_t smallNameIndex = _smallNameIndex.enabled ? sizeof(_smallNameIndex) : 0;
+    const size_t aliasIndex = _aliasIndex.groupedIndexes() != nullptr ? sizeof(_aliasIndex) : 0;
+    return names + sizeof(_parsedData) + sizeof(_valueIndex) + sizeof(_nameIndex) + smallNameIndex + aliasIndex;
+}
+
+/// All names of @p value, empty if it has none
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::NameRange EnumInfo<Enum, String>::valueNames(Enum value)
+{
+    const auto i = index(value);
+    if (!i.has_value())
+        return NameRange(nullptr, 0, 0);
+    return NameRange(_aliasIndex.groupedIndexes(), _aliasIndex.groupBegin(*i), _aliasIndex.groupEnd(*i));
+}
+
+/// Whether the name at @p index is not the first declared name of its value
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::isAlias(size_t index)
+{
+    return index < size() && _aliasIndex.canonicalIndex(index) != index;
+}
+
+/// Index of the first declared name with the same value as the name at @p index
+template<typename Enum, typename String>
+constexpr std::optional<size_t> EnumInfo<Enum, String>::canonicalIndex(size_t index)
+{
+    if (index >= size())
+        return std::nullopt;
+    return _aliasIndex.canonicalIndex(index);
+}
+
+#if ENUM_INFO_STATS
+/// Lookup counters of the enum, shared by all String types
+template<typename Enum, typename String>
+EnumLookupStats& EnumInfo<Enum, String>::lookupStats()
+{
+    return _enum_info_private::LookupStatsOf<Enum>::stats;
+}
+#endif
+
+/**
+ * Converts @p count @p values to @p names. Values without name get empty name.
+ * @return Number of values without name
+ */
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::valueNames(const Enum* values, size_t count, String* names)
+{
+    size_t errors = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const auto index = _valueIndex.find(values[i]);
+        names[i] = index.has_value() ? String(_parsedData.name(*index)) : String();
+        errors += !index.has_value();
+    }
+    return errors;
+}
+
+/**
+ * Converts @p count @p names to @p values. Values of unknown names are left untouched and,
+ * if @p errorMask is given, marked by set bits in it, which must have (count + 63) / 64 words.
+ * @return Number of unknown names
+ */
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::values(const std::string_view* names, size_t count, Enum* values, uint64_t* errorMask)
+{
+    return _enum_info_private::convertMasked(count, errorMask, [names, values](size_t i)
+    {
+        const auto index = findName(names[i]);
+        if (index.has_value())
+        {
+            values[i] = _parsedData.values[*index];
+        }
+        return index.has_value();
+    });
+}
+
+/**
+ * Checks @p count @p values for names, e.g. integers received from elsewhere, and marks those
+ * without name in @p errorMask like values(). Contiguous enums check by range compares that vectorize.
+ * @return Number of values without name
+ */
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::validate(const EnumType* values, size_t count, uint64_t* errorMask)
+{
+    return _enum_info_private::convertMasked(count, errorMask, [values](size_t i)
+    {
+        return isDeclared(values[i]);
+    });
+}
+
+/// Index of @p value in the smallest type able to hold any index, nullopt if @p value has no name
+template<typename Enum, typename String>
+constexpr std::optional<typename EnumInfo<Enum, String>::Code> EnumInfo<Enum, String>::encode(Enum value)
+{
+    const auto i = index(value);
+    if (!i.has_value())
+        return std::nullopt;
+    return static_cast<Code>(*i);
+}
+
+/// Value encoded by encode(), nullopt if @p code is not below size()
+template<typename Enum, typename String>
+constexpr std::optional<Enum> EnumInfo<Enum, String>::decode(Code code)
+{
+    return value(size_t(code));
+}
+
+/**
+ * Encodes @p count @p values to @p codes. Codes of values without name are left untouched and,
+ * if @p errorMask is given, marked by set bits in it, which must have (count + 63) / 64 words.
+ * @return Number of values without name
+ */
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::encode(const Enum* values, size_t count, Code* codes, uint64_t* errorMask)
+{
+    return _enum_info_private::convertMasked(count, errorMask, [values, codes](size_t i)
+    {
+        const auto index = _valueIndex.find(values[i]);
+        if (index.has_value())
+        {
+            codes[i] = static_cast<Code>(*index);
+        }
+        return index.has_value();
+    });
+}
+
+/**
+ * Decodes @p count @p codes to @p values. Values of codes not below size() are left untouched
+ * and marked in @p errorMask like by encode().
+ * @return Number of invalid codes
+ */
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::decode(const Code* codes, size_t count, Enum* values, uint64_t* errorMask)
+{
+    return _enum_info_private::convertMasked(count, errorMask, [codes, values](size_t i)
+    {
+        const bool isValid = codes[i] < size();
+        if (isValid)
+        {
+            values[i] = _parsedData.values[codes[i]];
+        }
+        return isValid;
+    });
+}
+
+/**
+ * Hash of names and values in declaration order, so that peers can cheaply check that they
+ * encode the enum alike. It does not depend on the enum name.
+ */
+template<typename Enum, typename String>
+constexpr uint64_t EnumInfo<Enum, String>::fingerprint()
+{
+    constexpr uint64_t fingerprint = []
+    {
+        uint64_t hash = size();
+        for (size_t i = 0; i < size(); ++i)
+        {
+            const auto value = static_cast<uint64_t>(static_cast<EnumType>(_parsedData.values[i]));
+            hash = _enum_info_private::hashName<>(_parsedData.name(i), hash ^ value);
+        }
+        return hash;
+    }();
+    return fingerprint;
+}
+
+/**
+ * Result of @p f called with @p value as std::integral_constant<Enum, value>, so that a handler
+ * is compiled for each value: in an optional, or whether @p f was called if it returns void.
+ * Values without name have no result.
+ */
+template<typename Enum, typename String>
+template<typename F>
+constexpr auto EnumInfo<Enum, String>::visit(Enum value, F&& f)
+{
+    using R = std::invoke_result_t<F&, std::integral_constant<Enum, _rawData._vals[0]>>;
+    if constexpr (std::is_void_v<R>)
+    {
+        return visit(value, [&f](auto constant) { f(constant); return true; }, [](Enum) { return false; });
+    }
+    else
+    {
+        return visit(value, [&f](auto constant) { return std::optional<R>(f(constant)); },
+                     [](Enum) { return std::optional<R>(); });
+    }
+}
+
+/// Result of @p f called with @p value as std::integral_constant, or of @p otherwise called with a value without name
+template<typename Enum, typename String>
+template<typename F, typename Otherwise>
+constexpr decltype(auto) EnumInfo<Enum, String>::visit(Enum value, F&& f, Otherwise&& otherwise)
+{
+    using R = std::invoke_result_t<F&, std::integral_constant<Enum, _rawData._vals[0]>>;
+    using Visitor = _enum_info_private::Visitor<Enum, R, std::remove_reference_t<F>, std::remove_reference_t<Otherwise>>;
+    return Visitor::visit(f, otherwise, value);
+}
+
+/// Scanner of text for names, see EnumNameScanner
+template<typename Enum, typename String>
+constexpr EnumNameScanner<Enum> EnumInfo<Enum, String>::scanner()
+{
+    return EnumNameScanner<Enum>();
+}
+
+#if defined(__cpp_lib_span)
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::valueNames(std::span<const Enum> values, std::span<String> names)
+{
+    assert(names.size() >= values.size());
+    return valueNames(values.data(), values.size(), names.data());
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::values(std::span<const std::string_view> names, std::span<Enum> values, std::span<uint64_t> errorMask)
+{
+    assert(values.size() >= names.size());
+    assert(errorMask.empty() || errorMask.size() * 64 >= names.size());
+    return EnumInfo::values(names.data(), names.size(), values.data(), errorMask.empty() ? nullptr : errorMask.data());
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::validate(std::span<const EnumType> values, std::span<uint64_t> errorMask)
+{
+    assert(errorMask.empty() || errorMask.size() * 64 >= values.size());
+    return validate(values.data(), values.size(), errorMask.empty() ? nullptr : errorMask.data());
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::encode(std::span<const Enum> values, std::span<Code> codes, std::span<uint64_t> errorMask)
+{
+    assert(codes.size() >= values.size());
+    assert(errorMask.empty() || errorMask.size() * 64 >= values.size());
+    return encode(values.data(), values.size(), codes.data(), errorMask.empty() ? nullptr : errorMask.data());
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::decode(std::span<const Code> codes, std::span<Enum> values, std::span<uint64_t> errorMask)
+{
+    assert(values.size() >= codes.size());
+    assert(errorMask.empty() || errorMask.size() * 64 >= codes.size());
+    return decode(codes.data(), codes.size(), values.data(), errorMask.empty() ? nullptr : errorMask.data());
+}
+#endif
+
+/// Writes name of @p value to @p out, nullopt if @p value has no name
+template<typename Enum, typename String>
+template<typename OutputIt>
+constexpr std::optional<OutputIt> EnumInfo<Enum, String>::appendName(Enum value, OutputIt out)
+{
+    const auto i = index(value);
+    if (!i.has_value())
+        return std::nullopt;
+
+    for (const char c: _parsedData.name(*i))
+    {
+        *out++ = c;
+    }
+    return out;
+}
+
+/// Writes name of @p value to @p buffer without terminating zero and returns its size,
+/// nullopt if @p value has no name or @p capacity is not enough
+template<typename Enum, typename String>
+constexpr std::optional<size_t> EnumInfo<Enum, String>::writeName(Enum value, char* buffer, size_t capacity)
+{
+    const auto i = index(value);
+    if (!i.has_value())
+        return std::nullopt;
+
+    const auto name = _parsedData.name(*i);
+    if (name.size() > capacity)
+        return std::nullopt;
+    for (size_t j = 0; j < name.size(); ++j)
+    {
+        buffer[j] = name[j];
+    }
+    return name.size();
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::begin()
+{
+    return iterator(0);
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::end()
+{
+    return iterator(size());
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::reverse_iterator EnumInfo<Enum, String>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::reverse_iterator EnumInfo<Enum, String>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+// ---- EnumInfo::iterator implementation ----
+
+template<typename Enum, typename String>
+constexpr EnumInfo<Enum, String>::iterator::iterator(size_t index)
+    : _index(index)
+{
+    assert(_index <= size());
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::iterator::index() const
+{
+    return _index;
+}
+
+template<typename Enum, typename String>
+constexpr Enum EnumInfo<Enum, String>::iterator::value() const
+{
+    return _parsedData.values[_index];
+}
+
+template<typename Enum, typename String>
+constexpr String EnumInfo<Enum, String>::iterator::name() const
+{
+    return String(_parsedData.name(_index));
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator::value_type EnumInfo<Enum, String>::iterator::operator*() const
+{
+    return *this;
+}
+
+/// Prefix operator++
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator& EnumInfo<Enum, String>::iterator::operator++()
+{
+    ++_index;
+    return *this;
+}
+
+/// Postfix operator++
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::iterator::operator++(int)
+{
+    EnumInfo<Enum, String>::iterator tmp(*this);
+    operator++();
+    return tmp;
+}
+
+/// Prefix operator--
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator& EnumInfo<Enum, String>::iterator::operator--()
+{
+    --_index;
+    return *this;
+}
+
+/// Postfix operator--
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::iterator::operator--(int)
+{
+    EnumInfo<Enum, String>::iterator tmp(*this);
+    operator--();
+    return tmp;
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::iterator::operator==(EnumInfo::iterator other) const
+{
+    return _index == other._index;
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::iterator::operator!=(EnumInfo::iterator other) const
+{
+    return !(*this == other);
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator::value_type EnumInfo<Enum, String>::iterator::operator[](difference_type offset) const
+{
+    return *this + offset;
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator& EnumInfo<Enum, String>::iterator::operator+=(difference_type offset)
+{
+    _index = static_cast<size_t>(static_cast<difference_type>(_index) + offset);
+    assert(_index <= size());
+    return *this;
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator& EnumInfo<Enum, String>::iterator::operator-=(difference_type offset)
+{
+    return *this += -offset;
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::iterator::operator+(difference_type offset) const
+{
+    iterator tmp(*this);
+    return tmp += offset;
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator EnumInfo<Enum, String>::iterator::operator-(difference_type offset) const
+{
+    iterator tmp(*this);
+    return tmp -= offset;
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::iterator::difference_type EnumInfo<Enum, String>::iterator::operator-(iterator other) const
+{
+    return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::iterator::operator<(iterator other) const
+{
+    return _index < other._index;
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::iterator::operator>(iterator other) const
+{
+    return other < *this;
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::iterator::operator<=(iterator other) const
+{
+    return !(other < *this);
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::iterator::operator>=(iterator other) const
+{
+    return !(*this < other);
+}
+
+// ---- EnumInfo::NameRange implementation ----
+
+template<typename Enum, typename String>
+constexpr EnumInfo<Enum, String>::NameRange::NameRange(const Index* grouped, size_t first, size_t last)
+    : _grouped(grouped)
+    , _first(first)
+    , _last(last)
+{
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::NameRange::iterator EnumInfo<Enum, String>::NameRange::begin() const
+{
+    return iterator(_grouped, _first);
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::NameRange::iterator EnumInfo<Enum, String>::NameRange::end() const
+{
+    return iterator(_grouped, _last);
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::NameRange::size() const
+{
+    return _last - _first;
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::NameRange::empty() const
+{
+    return _first == _last;
+}
+
+template<typename Enum, typename String>
+constexpr EnumInfo<Enum, String>::NameRange::iterator::iterator(const Index* grouped, size_t position)
+    : _grouped(grouped)
+    , _position(position)
+{
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::NameRange::iterator::index() const
+{
+    return _grouped != nullptr ? _grouped[_position] : _position;
+}
+
+template<typename Enum, typename String>
+constexpr String EnumInfo<Enum, String>::NameRange::iterator::operator*() const
+{
+    return String(_parsedData.name(index()));
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::NameRange::iterator& EnumInfo<Enum, String>::NameRange::iterator::operator++()
+{
+    ++_position;
+    return *this;
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::NameRange::iterator EnumInfo<Enum, String>::NameRange::iterator::operator++(int)
+{
+    iterator tmp(*this);
+    ++_position;
+    return tmp;
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::NameRange::iterator::operator==(iterator other) const
+{
+    return _position == other._position;
+}
+
+template<typename Enum, typename String>
+constexpr bool EnumInfo<Enum, String>::NameRange::iterator::operator!=(iterator other) const
+{
+    return !(*this == other);
+}
+
+// ---- FlagInfo implementation ----
+
+/// Writes flag names of @p value to @p out, nullopt if some bits of @p value have no name
+/// or @p value is 0 and the enum has no name for it
+template<typename Enum>
+template<typename OutputIt>
+constexpr std::optional<OutputIt> FlagInfo<Enum>::format(Enum value, OutputIt out)
+{
+    bool isFirst = true;
+    const bool isValid = decompose(value, [&out, &isFirst](size_t index)
+    {
+        if (!isFirst)
+        {
+            *out++ = separator;
+        }
+        isFirst = false;
+        for (const char c: Info::_parsedData.name(index))
+        {
+            *out++ = c;
+        }
+    });
+    if (!isValid)
+        return std::nullopt;
+    return out;
+}
+
+/// Writes flag names of @p value to @p buffer without terminating zero and returns their size,
+/// nullopt if some bits of @p value have no name or @p capacity is not enough
+template<typename Enum>
+constexpr std::optional<size_t> FlagInfo<Enum>::format(Enum value, char* buffer, size_t capacity)
+{
+    size_t size = 0;
+    const bool isValid = decompose(value, [buffer, capacity, &size](size_t index)
+    {
+        if (size != 0 && size++ < capacity)
+        {
+            buffer[size - 1] = separator;
+        }
+        for (const char c: Info::_parsedData.name(index))
+        {
+            if (size++ < capacity)
+            {
+                buffer[size - 1] = c;
+            }
+        }
+    });
+    if (!isValid || size > capacity)
+        return std::nullopt;
+    return size;
+}
+
+template<typename Enum>
+constexpr std::optional<size_t> FlagInfo<Enum>::formattedSize(Enum value)
+{
+    size_t size = 0;
+    const bool isValid = decompose(value, [&size](size_t index)
+    {
+        size += (size != 0) + Info::_parsedData.name(index).size();
+    });
+    if (!isValid)
+        return std::nullopt;
+    return size;
+}
+
+template<typename Enum>
+std::optional<std::string> FlagInfo<Enum>::toString(Enum value)
+{
+    const auto size = formattedSize(value);
+    if (!size.has_value())
+        return std::nullopt;
+    std::string string(*size, '\0');
+    format(value, string.data());
+    return string;
+}
+
+/// Parses flag names separated by '|' and optional spaces
+template<typename Enum>
+constexpr std::optional<Enum> FlagInfo<Enum>::parse(std::string_view names)
+{
+    const auto trim = [](std::string_view name)
+    {
+        while (!name.empty() && name.front() == ' ')
+            name.remove_prefix(1);
+        while (!name.empty() && name.back() == ' ')
+            name.remove_suffix(1);
+        return name;
+    };
+
+    uint64_t bits = 0;
+    for (size_t begin = 0; begin <= names.size();)
+    {
+        const size_t end = names.find(separator, begin);
+        const auto value = Info::value(trim(names.substr(begin, end - begin)));
+        if (!value.has_value())
+            return std::nullopt;
+        bits |= Tables::bits(*value);
+        begin = end == std::string_view::npos ? end : end + 1;
+    }
+    return static_cast<Enum>(bits);
+}
+
+/// Calls @p visit with indexes of names making up @p value, if all bits of @p value have names
+template<typename Enum>
+template<typename Visitor>
+constexpr bool FlagInfo<Enum>::decompose(Enum value, Visitor visit)
+{
+    const uint64_t bits = Tables::bits(value);
+    if (bits == 0)
+    {
+        // Without a name for 0 nothing would be written, which parse() doesn't accept
+        if (_tables.zeroIndex == Info::size())
+            return false;
+        visit(_tables.zeroIndex);
+        return true;
+    }
+
+    const auto isCovering = [bits](uint64_t composite, uint64_t rest)
+    {
+        return (composite & ~bits) == 0 && (composite & rest) != 0;
+    };
+
+    uint64_t rest = bits;
+    for (size_t i = 0; i < _tables.compositeCount; ++i)
+    {
+        const uint64_t composite = Tables::bits(Info::_parsedData.values[_tables.composites[i]]);
+        rest = isCovering(composite, rest) ? rest & ~composite : rest;
+    }
+    for (uint64_t bit = rest; bit != 0; bit &= bit - 1)
+    {
+        if (_tables.bitIndexes[_enum_info_private::countTrailingZeros(bit)] == Info::size())
+            return false;
+    }
+
+    rest = bits;
+    for (size_t i = 0; i < _tables.compositeCount; ++i)
+    {
+        const uint64_t composite = Tables::bits(Info::_parsedData.values[_tables.composites[i]]);
+        if (isCovering(composite, rest))
+        {
+            visit(_tables.composites[i]);
+            rest &= ~composite;
+        }
+    }
+    for (; rest != 0; rest &= rest - 1)
+    {
+        visit(_tables.bitIndexes[_enum_info_private::countTrailingZeros(rest)]);
+    }
+    return true;
+}
+
+// ---- EnumMap implementation ----
+
+template<typename Enum, typename T>
+constexpr EnumMap<Enum, T>::EnumMap(std::initializer_list<std::pair<Enum, T>> entries)
+{
+    for (const auto& entry: entries)
+    {
+        _values[slot(entry.first)] = entry.second;
+    }
+}
+
+/// Slot of @p key, which must have a name
+template<typename Enum, typename T>
+constexpr size_t EnumMap<Enum, T>::slot(Enum key)
+{
+    const auto index = Info::_valueIndex.find(key);
+    assert(index.has_value());
+    return *index;
+}
+
+/// First index from @p index on which is not an alias
+template<typename Enum, typename T>
+constexpr size_t EnumMap<Enum, T>::nextCanonical(size_t index)
+{
+    while (index < Info::size() && Info::_aliasIndex.canonicalIndex(index) != index)
+    {
+        ++index;
+    }
+    return index;
+}
+
+/// Mapped to @p key, which must have a name
+template<typename Enum, typename T>
+constexpr T& EnumMap<Enum, T>::operator[](Enum key)
+{
+    return _values[slot(key)];
+}
+
+template<typename Enum, typename T>
+constexpr const T& EnumMap<Enum, T>::operator[](Enum key) const
+{
+    return _values[slot(key)];
+}
+
+/// Mapped to @p key, throws std::out_of_range if @p key has no name
+template<typename Enum, typename T>
+constexpr T& EnumMap<Enum, T>::at(Enum key)
+{
+    if (const auto mapped = find(key))
+        return *mapped;
+    throw std::out_of_range("EnumMap::at: value without name");
+}
+
+template<typename Enum, typename T>
+constexpr const T& EnumMap<Enum, T>::at(Enum key) const
+{
+    if (const auto mapped = find(key))
+        return *mapped;
+    throw std::out_of_range("EnumMap::at: value without name");
+}
+
+/// Mapped to @p key, nullptr if @p key has no name
+template<typename Enum, typename T>
+constexpr T* EnumMap<Enum, T>::find(Enum key)
+{
+    const auto index = Info::_valueIndex.find(key);
+    return index.has_value() ? &_values[*index] : nullptr;
+}
+
+template<typename Enum, typename T>
+constexpr const T* EnumMap<Enum, T>::find(Enum key) const
+{
+    const auto index = Info::_valueIndex.find(key);
+    return index.has_value() ? &_values[*index] : nullptr;
+}
+
+/// Number of distinct values, that is of entries iterated
+template<typename Enum, typename T>
+constexpr size_t EnumMap<Enum, T>::size()
+{
+    size_t count = 0;
+    for (size_t index = nextCanonical(0); index < Info::size(); index = nextCanonical(index + 1))
+    {
+        ++count;
+    }
+    return count;
+}
+
+template<typename Enum, typename T>
+constexpr void EnumMap<Enum, T>::fill(const T& value)
+{
+    for (auto& mapped: _values)
+    {
+        mapped = value;
+    }
+}
+
+template<typename Enum, typename T>
+constexpr typename EnumMap<Enum, T>::iterator EnumMap<Enum, T>::begin()
+{
+    return iterator(_values.data(), nextCanonical(0));
+}
+
+template<typename Enum, typename T>
+constexpr typename EnumMap<Enum, T>::iterator EnumMap<Enum, T>::end()
+{
+    return iterator(_values.data(), Info::size());
+}
+
+template<typename Enum, typename T>
+constexpr typename EnumMap<Enum, T>::const_iterator EnumMap<Enum, T>::begin() const
+{
+    return const_iterator(_values.data(), nextCanonical(0));
+}
+
+template<typename Enum, typename T>
+constexpr typename EnumMap<Enum, T>::const_iterator EnumMap<Enum, T>::end() const
+{
+    return const_iterator(_values.data(), Info::size());
+}
+
+template<typename Enum, typename T>
+constexpr bool EnumMap<Enum, T>::operator==(const EnumMap& other) const
+{
+    for (size_t index = nextCanonical(0); index < Info::size(); index = nextCanonical(index + 1))
+    {
+        if (!(_values[index] == other._values[index]))
+            return false;
+    }
+    return true;
+}
+
+template<typename Enum, typename T>
+constexpr bool EnumMap<Enum, T>::operator!=(const EnumMap& other) const
+{
+    return !(*this == other);
+}
+
+template<typename Enum, typename T>
+template<bool IsConst>
+constexpr EnumMap<Enum, T>::Iterator<IsConst>::Iterator(Mapped* values, size_t index)
+    : _values(values)
+    , _index(index)
+{
+}
+
+template<typename Enum, typename T>
+template<bool IsConst>
+constexpr typename EnumMap<Enum, T>::template Iterator<IsConst>::value_type EnumMap<Enum, T>::Iterator<IsConst>::operator*() const
+{
+    return value_type(Info::_parsedData.values[_index], _values[_index]);
+}
+
+template<typename Enum, typename T>
+template<bool IsConst>
+constexpr typename EnumMap<Enum, T>::template Iterator<IsConst>& EnumMap<Enum, T>::Iterator<IsConst>::operator++()
+{
+    _index = nextCanonical(_index + 1);
+    return *this;
+}
+
+template<typename Enum, typename T>
+template<bool IsConst>
+constexpr typename EnumMap<Enum, T>::template Iterator<IsConst> EnumMap<Enum, T>::Iterator<IsConst>::operator++(int)
+{
+    const Iterator it = *this;
+    ++*this;
+    return it;
+}
+
+template<typename Enum, typename T>
+template<bool IsConst>
+constexpr bool EnumMap<Enum, T>::Iterator<IsConst>::operator==(Iterator other) const
+{
+    return _index == other._index;
+}
+
+template<typename Enum, typename T>
+template<bool IsConst>
+constexpr bool EnumMap<Enum, T>::Iterator<IsConst>::operator!=(Iterator other) const
+{
+    return !(*this == other);
+}
+
+// ---- EnumSet implementation ----
+
+template<typename Enum>
+constexpr EnumSet<Enum>::EnumSet(std::initializer_list<Enum> values)
+{
+    for (const auto value: values)
+    {
+        insert(value);
+    }
+}
+
+/// Set of all distinct values, aliases share the bit of their canonical index
+template<typename Enum>
+constexpr EnumSet<Enum> EnumSet<Enum>::all()
+{
+    EnumSet set;
+    for (size_t index = 0; index < Info::size(); ++index)
+    {
+        if (Info::_aliasIndex.canonicalIndex(index) == index)
+            set._words[index / 64] |= uint64_t(1) << (index % 64);
+    }
+    return set;
+}
+
+/// Whether @p value was inserted, values without name are not
+template<typename Enum>
+constexpr bool EnumSet<Enum>::insert(Enum value)
+{
+    const auto index = Info::_valueIndex.find(value);
+    if (!index.has_value())
+        return false;
+    const uint64_t bit = uint64_t(1) << (*index % 64);
+    const bool isInserted = (_words[*index / 64] & bit) == 0;
+    _words[*index / 64] |= bit;
+    return isInserted;
+}
+
+/// Number of erased values, 0 or 1
+template<typename Enum>
+constexpr size_t EnumSet<Enum>::erase(Enum value)
+{
+    const auto index = Info::_valueIndex.find(value);
+    if (!index.has_value())
+        return 0;
+    const uint64_t bit = uint64_t(1) << (*index % 64);
+    const bool isErased = (_words[*index / 64] & bit) != 0;
+    _words[*index / 64] &= ~bit;
+    return isErased ? 1 : 0;
+}
+
+template<typename Enum>
+constexpr bool EnumSet<Enum>::contains(Enum value) const
+{
+    const auto index = Info::_valueIndex.find(value);
+    return index.has_value() && (_words[*index / 64] >> (*index % 64) & 1) != 0;
+}
+
+/// Number of contained distinct values
+template<typename Enum>
+constexpr size_t EnumSet<Enum>::size() const
+{
+    size_t count = 0;
+    for (const auto word: _words)
+    {
+        count += _enum_info_private::popCount(word);
+    }
+    return count;
+}
+
+template<typename Enum>
+constexpr bool EnumSet<Enum>::empty() const
+{
+    uint64_t bits = 0;
+    for (const auto word: _words)
+    {
+        bits |= word;
+    }
+    return bits == 0;
+}
+
+template<typename Enum>
+constexpr void EnumSet<Enum>::clear()
+{
+    for (auto& word: _words)
+    {
+        word = 0;
+    }
+}
+
+template<typename Enum>
+constexpr EnumSet<Enum>& EnumSet<Enum>::operator|=(const EnumSet& other)
+{
+    for (size_t i = 0; i < wordCount; ++i)
+    {
+        _words[i] |= other._words[i];
+    }
+    return *this;
+}
+
+template<typename Enum>
+constexpr EnumSet<Enum>& EnumSet<Enum>::operator&=(const EnumSet& other)
+{
+    for (size_t i = 0; i < wordCount; ++i)
+    {
+        _words[i] &= other._words[i];
+    }
+    return *this;
+}
+
+template<typename Enum>
+constexpr EnumSet<Enum>& EnumSet<Enum>::operator-=(const EnumSet& other)
+{
+    for (size_t i = 0; i < wordCount; ++i)
+    {
+        _words[i] &= ~other._words[i];
+    }
+    return *this;
+}
+
+template<typename Enum>
+constexpr EnumSet<Enum> EnumSet<Enum>::operator|(const EnumSet& other) const
+{
+    EnumSet set = *this;
+    return set |= other;
+}
+
+template<typename Enum>
+constexpr EnumSet<Enum> EnumSet<Enum>::operator&(const EnumSet& other) const
+{
+    EnumSet set = *this;
+    return set &= other;
+}
+
+template<typename Enum>
+constexpr EnumSet<Enum> EnumSet<Enum>::operator-(const EnumSet& other) const
+{
+    EnumSet set = *this;
+    return set -= other;
+}
+
+template<typename Enum>
+constexpr bool EnumSet<Enum>::operator==(const EnumSet& other) const
+{
+    uint64_t difference = 0;
+    for (size_t i = 0; i < wordCount; ++i)
+    {
+        difference |= _words[i] ^ other._words[i];
+    }
+    return difference == 0;
+}
+
+template<typename Enum>
+constexpr bool EnumSet<Enum>::operator!=(const EnumSet& other) const
+{
+    return !(*this == other);
+}
+
+template<typename Enum>
+constexpr typename EnumSet<Enum>::iterator EnumSet<Enum>::begin() const
+{
+    return iterator(_words.data(), next(_words.data(), 0));
+}
+
+template<typename Enum>
+constexpr typename EnumSet<Enum>::iterator EnumSet<Enum>::end() const
+{
+    return iterator(_words.data(), Info::size());
+}
+
+/// First contained index from @p index on, Info::size() if there is none
+template<typename Enum>
+constexpr size_t EnumSet<Enum>::next(const uint64_t* words, size_t index)
+{
+    if (index >= Info::size())
+        return Info::size();
+    size_t word = index / 64;
+    uint64_t bits = words[word] & (~uint64_t(0) << (index % 64));
+    while (bits == 0)
+    {
+        if (++word == wordCount)
+            return Info::size();
+        bits = words[word];
+    }
+    return word * 64 + _enum_info_private::countTrailingZeros(bits);
+}
+
+template<typename Enum>
+constexpr EnumSet<Enum>::iterator::iterator(const uint64_t* words, size_t index)
+    : _words(words)
+    , _index(index)
+{
+}
+
+template<typename Enum>
+constexpr Enum EnumSet<Enum>::iterator::operator*() const
+{
+    return Info::_parsedData.values[_index];
+}
+
+template<typename Enum>
+constexpr typename EnumSet<Enum>::iterator& EnumSet<Enum>::iterator::operator++()
+{
+    _index = next(_words, _index + 1);
+    return *this;
+}
+
+template<typename Enum>
+constexpr typename EnumSet<Enum>::iterator EnumSet<Enum>::iterator::operator++(int)
+{
+    const iterator it = *this;
+    ++*this;
+    return it;
+}
+
+template<typename Enum>
+constexpr bool EnumSet<Enum>::iterator::operator==(iterator other) const
+{
+    return _index == other._index;
+}
+
+template<typename Enum>
+constexpr bool EnumSet<Enum>::iterator::operator!=(iterator other) const
+{
+    return !(*this == other);
+}
+
+// ---- EnumInfo::Parser implementation ----
+
+/**
+ * Consumes chars of the name from the front of @p input until it is decided, so that on Match
+ * @p input begins with the char after the name. NeedMore consumes all of @p input.
+ * Once decided, the result stays until reset().
+ */
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::Parser::Result EnumInfo<Enum, String>::Parser::parse(std::string_view& input)
+{
+    size_t node = _state;
+    size_t i = 0;
+    while (node < _trie.size)
+    {
+        if (i == input.size())
+            break;
+        if (!_enum_info_private::identChars[static_cast<unsigned char>(input[i])])
+        {
+            node = ended(node);
+            break;
+        }
+        node = _trie.child(node, input[i++]);
+    }
+    _state = static_cast<decltype(_state)>(node);
+    input.remove_prefix(i);
+    return result();
+}
+
+/// Ends the name at the end of input, e.g. of a length-prefixed field
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::Parser::Result EnumInfo<Enum, String>::Parser::finish()
+{
+    if (_state < _trie.size)
+    {
+        _state = static_cast<decltype(_state)>(ended(_state));
+    }
+    return result();
+}
+
+template<typename Enum, typename String>
+constexpr typename EnumInfo<Enum, String>::Parser::Result EnumInfo<Enum, String>::Parser::result() const
+{
+    if (_state < _trie.size)
+        return Result::NeedMore;
+    return _state == _trie.size ? Result::NoMatch : Result::Match;
+}
+
+/// Value parsed, nullopt unless the result is Match
+template<typename Enum, typename String>
+constexpr std::optional<Enum> EnumInfo<Enum, String>::Parser::value() const
+{
+    if (_state <= _trie.size)
+        return std::nullopt;
+    return _parsedData.values[_state - _trie.size - 1];
+}
+
+/// Starts parsing a new name
+template<typename Enum, typename String>
+constexpr void EnumInfo<Enum, String>::Parser::reset()
+{
+    _state = 0;
+}
+
+template<typename Enum, typename String>
+constexpr size_t EnumInfo<Enum, String>::Parser::ended(size_t node)
+{
+    const size_t name = _trie.names[node];
+    return name == size() ? _trie.size : _trie.size + 1 + name;
+}
+
+// ---- EnumNameScanner implementation ----
+
+template<typename Enum>
+constexpr size_t EnumNameScanner<Enum>::maxNameSize()
+{
+    size_t maxSize = 0;
+    for (size_t i = 0; i < Info::size(); ++i)
+    {
+        maxSize = std::max(maxSize, Info::_parsedData.name(i).size());
+    }
+    return maxSize;
+}
+
+/// Bit of every name size below 64
+template<typename Enum>
+constexpr uint64_t EnumNameScanner<Enum>::nameSizes()
+{
+    uint64_t sizes = 0;
+    for (size_t i = 0; i < Info::size(); ++i)
+    {
+        const size_t size = Info::_parsedData.name(i).size();
+        sizes |= size < 64 ? uint64_t(1) << size : 0;
+    }
+    return sizes;
+}
+
+/// Whether some name has @p size, long sizes are not told apart
+template<typename Enum>
+constexpr bool EnumNameScanner<Enum>::mayBeName(size_t size)
+{
+    constexpr size_t maxSize = maxNameSize();
+    constexpr uint64_t sizes = nameSizes();
+    return size <= maxSize && (size >= 64 || (sizes >> size & 1) != 0);
+}
+
+template<typename Enum>
+template<typename OnMatch>
+constexpr void EnumNameScanner<Enum>::match(std::string_view identifier, size_t offset, OnMatch& onMatch) const
+{
+    if (!mayBeName(identifier.size()))
+        return;
+    if (const auto index = Info::findName(identifier))
+    {
+        onMatch(Match{offset, Info::_parsedData.values[*index]});
+    }
+}
+
+/**
+ * Calls @p onMatch with every Match in @p text, the next chunk of the stream. An identifier
+ * at the end of @p text may go on in the next chunk, so it is matched by a later call.
+ */
+template<typename Enum>
+template<typename OnMatch>
+constexpr void EnumNameScanner<Enum>::scan(std::string_view text, OnMatch onMatch)
+{
+    const auto isIdentChar = [](char c)
+    {
+        return _enum_info_private::identChars[static_cast<unsigned char>(c)];
+    };
+
+    size_t i = 0;
+    if (_pendingSize > 0)
+    {
+        for (; i < text.size() && isIdentChar(text[i]); ++i)
+        {
+            if (_pendingSize < maxNameSize())
+            {
+                _pending[_pendingSize] = text[i];
+            }
+            _pendingSize += _pendingSize <= maxNameSize() ? 1 : 0;
+        }
+        if (i == text.size())
+        {
+            _offset += text.size();
+            return;
+        }
+        if (_pendingSize <= maxNameSize())
+        {
+            match(std::string_view(_pending.data(), _pendingSize), _offset + i - _pendingSize, onMatch);
+        }
+        _pendingSize = 0;
+    }
+
+    // Identifiers are found by masks of ident chars in windows of 64 chars, a window never starts inside one
+    while (i < text.size())
+    {
+        const size_t width = std::min<size_t>(text.size() - i, 64);
+        const uint64_t ident = _enum_info_private::identMask(text.data() + i, width);
+        size_t next = i + width;
+        for (uint64_t starts = ident & ~(ident << 1); starts != 0; starts &= starts - 1)
+        {
+            const size_t begin = i + _enum_info_private::countTrailingZeros(starts);
+            const uint64_t ends = ~ident & (~uint64_t(0) << (begin - i));
+            // Chars past a short window are clear in ident, so only a full window may have no end
+            size_t end = i + (ends != 0 ? _enum_info_private::countTrailingZeros(ends) : 64);
+            if (end == i + width)
+            {
+                // Go on from the identifier in the next window, unless it fills the window or ends the text
+                if (begin > i && end < text.size())
+                {
+                    next = begin;
+                    break;
+                }
+                while (end < text.size() && isIdentChar(text[end]))
+                {
+                    ++end;
+                }
+                next = end;
+                if (end == text.size())
+                {
+                    for (size_t j = 0; j < end - begin && j < maxNameSize(); ++j)
+                    {
+                        _pending[j] = text[begin + j];
+                    }
+                    _pendingSize = end - begin <= maxNameSize() ? end - begin : maxNameSize() + 1;
+                    break;
+                }
+            }
+            match(text.substr(begin, end - begin), _offset + begin, onMatch);
+        }
+        i = next;
+    }
+    _offset += text.size();
+}
+
+/// Ends the stream: matches the identifier at its end and starts a new stream
+template<typename Enum>
+template<typename OnMatch>
+constexpr void EnumNameScanner<Enum>::finish(OnMatch onMatch)
+{
+    if (_pendingSize > 0 && _pendingSize <= maxNameSize())
+    {
+        match(std::string_view(_pending.data(), _pendingSize), _offset - _pendingSize, onMatch);
+    }
+    _offset = 0;
+    _pendingSize = 0;
+}
+
+/// Adds matches in @p text to @p counts, aliases count for their value
+template<typename Enum>
+constexpr void EnumNameScanner<Enum>::count(std::string_view text, EnumMap<Enum, size_t>& counts)
+{
+    scan(text, [&counts](const Match& found) { ++counts[found.value]; });
+}
+
+template<typename Enum>
+constexpr void EnumNameScanner<Enum>::finish(EnumMap<Enum, size_t>& counts)
+{
+    finish([&counts](const Match& found) { ++counts[found.value]; });
+}
+
+// ---- EnumLookupStats implementation ----
+
+#if ENUM_INFO_STATS
+inline uint64_t EnumLookupStats::calls(EnumLookup lookup) const
+{
+    return _counters[size_t(lookup)].calls.load(std::memory_order_relaxed);
+}
+
+inline uint64_t EnumLookupStats::misses(EnumLookup lookup) const
+{
+    return _counters[size_t(lookup)].misses.load(std::memory_order_relaxed);
+}
+
+/// Lookups in latency bucket @p bucket, always 0 unless ENUM_INFO_STATS_LATENCY is 1
+inline uint64_t EnumLookupStats::latencies([[maybe_unused]] EnumLookup lookup, [[maybe_unused]] size_t bucket) const
+{
+#if ENUM_INFO_STATS_LATENCY
+    return _counters[size_t(lookup)].latencies[bucket].load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
+
+/// Zeroes counters, the enum stays registered
+inline void EnumLookupStats::reset()
+{
+    for (auto& counters: _counters)
+    {
+        counters.calls.store(0, std::memory_order_relaxed);
+        counters.misses.store(0, std::memory_order_relaxed);
+#if ENUM_INFO_STATS_LATENCY
+        for (auto& latency: counters.latencies)
+        {
+            latency.store(0, std::memory_order_relaxed);
+        }
+#endif
+    }
+}
+
+/// Most recently registered enum, nullptr if no lookup happened yet
+inline const EnumLookupStats* EnumLookupStats::first()
+{
+    return _first.load(std::memory_order_acquire);
+}
+
+inline const EnumLookupStats* EnumLookupStats::next() const
+{
+    return _next;
+}
+
+/// Prints calls, misses and nonzero latency buckets of every registered enum and lookup
+inline void EnumLookupStats::dump(std::ostream& out)
+{
+    static constexpr const char* lookupNames[lookupCount] = {"by value", "by index", "by name", "by folded name"};
+
+    for (auto stats = first(); stats != nullptr; stats = stats->next())
+    {
+        for (size_t i = 0; i < lookupCount; ++i)
+        {
+            const auto lookup = static_cast<EnumLookup>(i);
+            if (stats->calls(lookup) == 0)
+                continue;
+            out << stats->enumName() << ' ' << lookupNames[i] << ": " << stats->calls(lookup)
+                << " calls, " << stats->misses(lookup) << " misses";
+            for (size_t bucket = 0; bucket < latencyBucketCount; ++bucket)
+            {
+                if (stats->latencies(lookup, bucket) != 0)
+                    out << ", <" << (uint64_t(1) << bucket) << "ns: " << stats->latencies(lookup, bucket);
+            }
+            out << '\n';
+        }
+    }
+}
+
+template<typename Func>
+auto EnumLookupStats::measure(EnumLookup lookup, Func func)
+{
+#if ENUM_INFO_STATS_LATENCY
+    const auto start = std::chrono::steady_clock::now();
+    const auto result = func();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    add(lookup, result.has_value(), uint64_t(elapsed.count()));
+#else
+    const auto result = func();
+    add(lookup, result.has_value(), 0);
+#endif
+    return result;
+}
+
+inline void EnumLookupStats::add(EnumLookup lookup, bool isHit, [[maybe_unused]] uint64_t nanoseconds)
+{
+    if (!_isRegistered.load(std::memory_order_relaxed) && !_isRegistered.exchange(true))
+    {
+        // Lock-free push, registered enums are never removed
+        _next = _first.load(std::memory_order_relaxed);
+        while (!_first.compare_exchange_weak(_next, this, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    auto& counters = _counters[size_t(lookup)];
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    if (!isHit)
+        counters.misses.fetch_add(1, std::memory_order_relaxed);
+#if ENUM_INFO_STATS_LATENCY
+    size_t bucket = 0;
+    while (bucket + 1 < latencyBucketCount && nanoseconds >= (uint64_t(1) << bucket))
+    {
+        ++bucket;
+    }
+    counters.latencies[bucket].fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+#endif
+
+// ---- EnumRegistry implementation ----
+
+#if ENUM_INFO_REGISTRY
+/// Registered enum with EnumInfo::qualifiedName() @p qualifiedName, nullptr if there is none
+inline const EnumRegistry::Entry* EnumRegistry::find(std::string_view qualifiedName)
+{
+    const auto& entries = index().entries;
+    const auto it = std::lower_bound(entries.begin(), entries.end(), qualifiedName, [](const Entry* entry, std::string_view name)
+    {
+        return entry->qualifiedName < name;
+    });
+    if (it == entries.end() || (*it)->qualifiedName != qualifiedName)
+        return nullptr;
+    return *it;
+}
+
+/// Registered enum with EnumInfo::typeHash() @p typeHash, nullptr if there is none
+inline const EnumRegistry::Entry* EnumRegistry::find(uint64_t typeHash)
+{
+    const auto& hashed = index().hashed;
+    const auto it = std::lower_bound(hashed.begin(), hashed.end(), typeHash, [](const Entry* entry, uint64_t hash)
+    {
+        return entry->typeHash < hash;
+    });
+    if (it == hashed.end() || (*it)->typeHash != typeHash)
+        return nullptr;
+    return *it;
+}
+
+/// Value named @p valueName of enum @p qualifiedName as int64_t
+inline std::optional<int64_t> EnumRegistry::lookupValue(std::string_view qualifiedName, std::string_view valueName)
+{
+    const auto entry = find(qualifiedName);
+    if (entry == nullptr)
+        return std::nullopt;
+    return entry->value(valueName);
+}
+
+inline std::optional<int64_t> EnumRegistry::lookupValue(uint64_t typeHash, std::string_view valueName)
+{
+    const auto entry = find(typeHash);
+    if (entry == nullptr)
+        return std::nullopt;
+    return entry->value(valueName);
+}
+
+inline std::optional<std::string_view> EnumRegistry::lookupValueName(std::string_view qualifiedName, int64_t value)
+{
+    const auto entry = find(qualifiedName);
+    if (entry == nullptr)
+        return std::nullopt;
+    return entry->valueName(value);
+}
+
+inline std::optional<std::string_view> EnumRegistry::lookupValueName(uint64_t typeHash, int64_t value)
+{
+    const auto entry = find(typeHash);
+    if (entry == nullptr)
+        return std::nullopt;
+    return entry->valueName(value);
+}
+
+/// Number of registered enums
+inline size_t EnumRegistry::size()
+{
+    return index().entries.size();
+}
+
+/// Registers @p entry, called by ENUM_DECLARE and ENUM_DECLARE_NS
+inline void EnumRegistry::add(Entry& entry)
+{
+    entry.next = _first.load(std::memory_order_relaxed);
+    while (!_first.compare_exchange_weak(entry.next, &entry, std::memory_order_release, std::memory_order_relaxed)) {}
+    _registeredCount.fetch_add(1, std::memory_order_release);
+}
+
+inline const EnumRegistry::Index& EnumRegistry::index()
+{
+    const Index* current = _index.load(std::memory_order_acquire);
+    if (current != nullptr && current->registeredCount == _registeredCount.load(std::memory_order_acquire))
+        return *current;
+
+    std::lock_guard<std::mutex> lock(_indexMutex);
+    current = _index.load(std::memory_order_acquire);
+    if (current != nullptr && current->registeredCount == _registeredCount.load(std::memory_order_acquire))
+        return *current;
+
+    auto built = new Index{{}, {}, 0, current};
+    for (auto entry = _first.load(std::memory_order_acquire); entry != nullptr; entry = entry->next)
+    {
+        built->entries.push_back(entry);
+    }
+    built->registeredCount = built->entries.size();
+    std::sort(built->entries.begin(), built->entries.end(), [](const Entry* l, const Entry* r)
+    {
+        return l->qualifiedName < r->qualifiedName;
+    });
+    built->hashed = built->entries;
+    std::sort(built->hashed.begin(), built->hashed.end(), [](const Entry* l, const Entry* r)
+    {
+        return l->typeHash < r->typeHash;
+    });
+    _index.store(built, std::memory_order_release);
+    return *built;
+}
+#endif
+
+// ---- Ranges ----
+
+#if defined(__cpp_lib_ranges)
+/// EnumInfo<Enum>() is an empty view of all entries, its iterators outlive it
+namespace std::ranges
+{
+template<typename Enum, typename String>
+inline constexpr bool enable_view<EnumInfo<Enum, String>> = true;
+
+template<typename Enum, typename String>
+inline constexpr bool enable_borrowed_range<EnumInfo<Enum, String>> = true;
+}
+#endif
+
+// ---- Formatters ----
+
+#if defined(__cpp_lib_format)
+/// Formats enums declared by ENUM_DECLARE or ENUM_DECLARE_NS by value name (or number if it has no name)
+template<typename Enum>
+    requires _enum_info_private::IsReflected<Enum>::value
+struct std::formatter<Enum, char> : std::formatter<std::string_view, char>
+{
+    template<typename FormatContext>
+    auto format(Enum value, FormatContext& context) const
+    {
+        char buffer[24];
+        const auto name = _enum_info_private::nameOrNumber<EnumInfo<Enum>>(value, buffer);
+        return std::formatter<std::string_view, char>::format(name, context);
+    }
+};
+#endif
+
+#if defined(FMT_VERSION)
+/// Same as std::formatter for {fmt}, which has to be included before EnumInfo.h
+template<typename Enum>
+struct fmt::formatter<Enum, char, std::enable_if_t<_enum_info_private::IsReflected<Enum>::value>>
+    : fmt::formatter<fmt::string_view, char>
+{
+    template<typename FormatContext>
+    auto format(Enum value, FormatContext& context) const
+    {
+        char buffer[24];
+        const auto name = _enum_info_private::nameOrNumber<EnumInfo<Enum>>(value, buffer);
+        return fmt::formatter<fmt::string_view, char>::format(fmt::string_view(name.data(), name.size()), context);
+    }
+};
+#endif
@@ -1,7 +1,44 @@
+#if ENUM_INFO_TEST_FMT
+// EnumInfo.h specializes fmt::formatter only if {fmt} is included first
+#include <fmt/format.h>
+#endif
 #include "EnumInfo.h"
 
 #include <iostream>
 #include <limits>
+#include <algorithm>
+#include <vector>
+#include <cctype>
+#include <cstdlib>
+#include <new>
+#include <atomic>
+#include <thread>
+#include <sstream>
+#if __has_include(<execution>)
+#include <execution>
+#endif
+
+
+// Counts heap allocations to check that lookups don't allocate
+static size_t allocationCount = 0;
+
+void* operator new(size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
 
 
 ENUM_DECLARE_NS( CardSuit, int8_t,
@@ -58,6 +95,179 @@ struct Cs
 };
 }
 
+ENUM_DECLARE_NS( Direction, uint8_t,
+    Up,
+    Down,
+    Default = Up
+)
+
+// Initializers using enumerators with implicit values
+ENUM_DECLARE_NS( OpenMode, uint8_t,
+    Closed,
+    Read,
+    Write,
+    ReadWrite = Read | Write,
+    Append,
+    Exclusive = Append << 2,
+    Shared,
+    ReadOnly = Read
+)
+
+// Names equal after folding
+ENUM_DECLARE_NS( Setting, uint8_t,
+    KeepAlive,
+    keep_alive,
+    MaxConnections,
+    Timeout
+)
+
+// More names equal after folding than fit in one bucket of a name index
+namespace spellings
+{
+ENUM_DECLARE_NS( Spelling, uint8_t,
+    LogLevel, Loglevel, LOGLEVEL, loglevel, logLevel, LogLEVEL, LOGLevel, lOGLEVEL, logleveL,
+    LoGlEvEl, lOgLeVeL, log_level, Log_Level, LOG_LEVEL, Log_level, log_Level, LOG_level, log_LEVEL
+)
+}
+
+#if ENUM_INFO_SCAN
+// Enums without ENUM_DECLARE, reflected by scanning EnumScanRange
+namespace third_party
+{
+enum class Level : int8_t { Error = -1, Warning = 1, Info = 2, Debug = 4 };
+
+struct Widget
+{
+    enum State : uint16_t { Hidden, Shown = 300, Disabled };
+};
+}
+
+template<>
+struct EnumScanRange<third_party::Widget::State>
+{
+    static constexpr int64_t min = -10;
+    static constexpr int64_t max = 400;
+};
+#endif
+
+template<typename Enum>
+constexpr size_t countNamesLength()
+{
+    size_t length = 0;
+    for (auto it: EnumInfo<Enum>())
+    {
+        length += it.name().size();
+    }
+    return length;
+}
+
+// Reflection data is built at compile time
+static_assert(EnumInfo<CardSuit>::name() == "CardSuit");
+static_assert(EnumInfo<CardSuit>::size() == 4);
+// Implicit values are resolved before later initializers use them
+static_assert(EnumInfo<OpenMode>::value("Closed") == OpenMode(0));
+static_assert(EnumInfo<OpenMode>::value("ReadWrite") == OpenMode(3));
+static_assert(EnumInfo<OpenMode>::value("Exclusive") == OpenMode(16));
+static_assert(EnumInfo<OpenMode>::value("Shared") == OpenMode(17));
+static_assert(EnumInfo<OpenMode>::value("ReadOnly") == Read);
+static_assert(EnumInfo<OpenMode>::valueName(Shared) == "Shared");
+static_assert(EnumInfo<CardSuit>::qualifiedName() == "CardSuit");
+static_assert(EnumInfo<SomeNamespace::Ports>::qualifiedName() == "SomeNamespace::Ports");
+static_assert(EnumInfo<ns::Cs::Color>::qualifiedName() == "ns::Cs::Color");
+static_assert(EnumInfo<ns::Cs::Color>::typeHash() != EnumInfo<SomeNamespace::Ports>::typeHash());
+#if ENUM_INFO_SCAN
+static_assert(EnumInfo<third_party::Level>::name() == "Level");
+static_assert(EnumInfo<third_party::Level>::qualifiedName() == "third_party::Level");
+static_assert(EnumInfo<third_party::Level>::value("Warning") == third_party::Level::Warning);
+static_assert(EnumInfo<third_party::Widget::State>::size() == 3);
+#endif
+// Values encoded as indexes of the smallest type
+static_assert(std::is_same_v<EnumInfo<SomeClass::TasteFlags>::Code, uint8_t>);
+static_assert(EnumInfo<SomeClass::TasteFlags>::encode(SomeClass::TasteFlags::Last) == 6);
+static_assert(EnumInfo<SomeNamespace::Ports>::encode(SomeNamespace::Ports::SSH) == 2);
+static_assert(EnumInfo<SomeNamespace::Ports>::decode(3) == SomeNamespace::Ports::SSH);
+static_assert(!EnumInfo<CardSuit>::decode(4).has_value());
+static_assert(EnumInfo<CardSuit>::fingerprint() != EnumInfo<ns::Cs::Color>::fingerprint());
+static_assert(EnumInfo<CardSuit>::fingerprint() == EnumInfo<CardSuit, std::string>::fingerprint());
+static_assert(EnumMap<CardSuit, int>{{CardSuit::Hearts, 2}}[CardSuit::Hearts] == 2);
+static_assert(EnumMap<SomeNamespace::Ports, int>::size() == 3);
+static_assert(EnumSet<CardSuit>{CardSuit::Clubs}.contains(CardSuit::Clubs));
+static_assert((EnumSet<CardSuit>::all() - EnumSet<CardSuit>{CardSuit::Spades}).size() == 3);
+static_assert(*EnumSet<CardSuit>{CardSuit::Clubs, CardSuit::Hearts}.begin() == CardSuit::Hearts);
+static_assert(EnumInfo<CardSuit>::visit(CardSuit::Diamonds, [](auto suit) { return int(suit.value); }) == 2);
+static_assert(EnumInfo<ns::Cs::Color>::visit(ns::Cs::Color::Blue, [](auto color) { return int(color()); }) == 3);
+static_assert(!EnumInfo<ns::Cs::Color>::visit(static_cast<ns::Cs::Color>(0), [](auto color) { return int(color()); }).has_value());
+static_assert(EnumInfo<SomeNamespace::Ports>::visit(SomeNamespace::Ports::SSH, [](auto port) { return port == SomeNamespace::Ports::SSH; }) == true);
+static_assert(EnumInfo<SomeNamespace::Ports>::visit(static_cast<SomeNamespace::Ports>(81), [](auto) { return 0; }, [](auto) { return -1; }) == -1);
+static_assert(EnumInfo<CardSuit>::isValid(3) && !EnumInfo<CardSuit>::isValid(4) && !EnumInfo<CardSuit>::isValid(-1));
+static_assert(EnumInfo<SomeNamespace::Ports>::fromUnderlying(443) == SomeNamespace::Ports::HTTPS);
+static_assert(!EnumInfo<ns::Cs::Color>::fromUnderlying(0).has_value());
+static_assert(EnumInfo<SomeNamespace::Ports>::valueOrNumber("443") == SomeNamespace::Ports::HTTPS);
+static_assert(EnumInfo<ns::Cs::Color>::valueOrNumber("-1") == ns::Cs::Color::Transparent);
+static_assert(!EnumInfo<SomeNamespace::Ports>::valueOrNumber("444").has_value());
+static_assert([]
+{
+    size_t found = 0;
+    auto scanner = EnumInfo<CardSuit>::scanner();
+    scanner.scan("Spades, Clubs and Jok", [&found](auto) { ++found; });
+    scanner.scan("er of Hearts", [&found](auto) { ++found; });
+    scanner.finish([&found](auto) { ++found; });
+    return found;
+}() == 3);
+static_assert([]
+{
+    EnumInfo<SomeNamespace::Ports>::Parser parser;
+    std::string_view first = "HTT";
+    std::string_view second = "PS\r\n";
+    return parser.parse(first) == EnumInfo<SomeNamespace::Ports>::Parser::Result::NeedMore
+           && parser.parse(second) == EnumInfo<SomeNamespace::Ports>::Parser::Result::Match
+           && parser.value() == SomeNamespace::Ports::HTTPS
+           && second == "\r\n";
+}());
+static_assert(sizeof(EnumInfo<SomeNamespace::Ports>::Parser) == 1);
+static_assert(EnumInfo<CardSuit>::valueName(CardSuit::Diamonds) == "Diamonds");
+static_assert(EnumInfo<SomeClass::TasteFlags>::value("SourSweet") == SomeClass::TasteFlags::SourSweet);
+static_assert(EnumInfo<SomeNamespace::Ports>::index(SomeNamespace::Ports::SSH) == 2u);
+static_assert(EnumInfo<ns::Cs::Color>::value("Blue") == ns::Cs::Color::Blue);
+static_assert(EnumInfo<Direction>::value(size_t(2)) == Direction::Up);
+static_assert(countNamesLength<CardSuit>() == 25);
+// Values absent from dense (Color) and sparse (Ports, TasteFlags) tables
+static_assert(!EnumInfo<ns::Cs::Color>::index(static_cast<ns::Cs::Color>(0)).has_value());
+static_assert(!EnumInfo<ns::Cs::Color>::index(static_cast<ns::Cs::Color>(4)).has_value());
+static_assert(!EnumInfo<SomeNamespace::Ports>::index(static_cast<SomeNamespace::Ports>(81)).has_value());
+static_assert(EnumInfo<SomeClass::TasteFlags>::index(SomeClass::TasteFlags::Last) == 6u);
+static_assert(!EnumInfo<SomeClass::TasteFlags>::index(static_cast<SomeClass::TasteFlags>(3)).has_value());
+static_assert(FlagInfo<SomeClass::TasteFlags>::parse("Salted|Sweet") == SomeClass::TasteFlags(5));
+static_assert(FlagInfo<SomeClass::TasteFlags>::formattedSize(SomeClass::TasteFlags(5)) == 12u);
+static_assert(!FlagInfo<ns::Cs::Color>::formattedSize(ns::Cs::Color(0)).has_value());
+// Names absent from perfect hash tables
+static_assert(!EnumInfo<CardSuit>::value("Joker").has_value());
+static_assert(!EnumInfo<CardSuit>::value("Spade").has_value());
+static_assert(!EnumInfo<CardSuit>::value("Spadess").has_value());
+static_assert(!EnumInfo<SomeNamespace::Ports>::index("").has_value());
+static_assert(EnumInfo<SomeNamespace::Ports>::valueNames(SomeNamespace::Ports::SSH).size() == 2);
+static_assert(*EnumInfo<SomeNamespace::Ports>::valueNames(SomeNamespace::Ports::SSH).begin() == "SecureShell");
+static_assert(EnumInfo<SomeNamespace::Ports>::isAlias(3) && !EnumInfo<SomeNamespace::Ports>::isAlias(2));
+static_assert(EnumInfo<Direction>::canonicalIndex(2) == 0u);
+// Random access iteration
+static_assert(std::is_trivially_copyable_v<EnumInfo<CardSuit>::iterator>);
+static_assert(EnumInfo<CardSuit>::begin()[2].name() == "Diamonds");
+static_assert(EnumInfo<CardSuit>::end() - EnumInfo<CardSuit>::begin() == 4);
+static_assert((*EnumInfo<CardSuit>::rbegin()).name() == "Clubs");
+static_assert((EnumInfo<CardSuit>::end() - 3).value() == CardSuit::Hearts);
+#if defined(__cpp_lib_ranges)
+static_assert(std::ranges::random_access_range<EnumInfo<CardSuit>>);
+static_assert(std::ranges::sized_range<EnumInfo<CardSuit>>);
+static_assert(std::ranges::view<EnumInfo<CardSuit>>);
+static_assert(std::ranges::borrowed_range<EnumInfo<CardSuit>>);
+#endif
+static_assert(EnumInfo<SomeNamespace::Ports>::valueCaseInsensitive("https") == SomeNamespace::Ports::HTTPS);
+static_assert(EnumInfo<Setting>::index("KEEP-ALIVE", IgnoreCaseAndSeparators()) == 0u);
+static_assert(EnumInfo<spellings::Spelling>::value("LOG-LEVEL", IgnoreCaseAndSeparators()) == spellings::LogLevel);
+static_assert(EnumInfo<spellings::Spelling>::valueCaseInsensitive("LOG_LEVEL") == spellings::log_level);
+static_assert(EnumInfo<spellings::Spelling>::value("lOgLeVeL") == spellings::lOgLeVeL);
+static_assert(!EnumInfo<Setting>::index("KEEP-ALIVE", IgnoreCase()).has_value());
+
 template<typename Enum>
 void printEnum()
 {
@@ -70,9 +280,14 @@ void printEnum()
                 << std::to_string(it.value()) << " - "
                 << it.name() << std::endl;
     }
-    std::cout << "Enum size is " << EnumInfo<Enum>::size() << std::endl << std::endl;
+    std::cout << "Enum size is " << EnumInfo<Enum>::size() << std::endl;
+    std::cout << "Reflection data takes " << EnumInfo<Enum>::dataSize() << " bytes, "
+              << (EnumInfo<Enum>::dataSize() - countNamesLength<Enum>()) / EnumInfo<Enum>::size()
+              << " bytes per entry besides names, none on heap" << std::endl << std::endl;
 }
 
+static size_t failedTestCount = 0;
+
 template<typename F>
 bool test(std::string_view testName, F testFunc)
 {
@@ -84,6 +299,8 @@ bool test(std::string_view testName, F testFunc)
     std::cout << "\"" << testName << "\" test ... ";
     const bool isOk = testFunc();
     std::cout << "\b\b\b\bdone with " << printOkFail(isOk) << std::endl;
+    if (!isOk)
+        ++failedTestCount;
     return isOk;
 }
 
@@ -172,6 +389,64 @@ bool testValueByValueName(Enum value, std::string_view valueName)
     return isSame;
 }
 
+template<typename Enum>
+bool testNoValueByValueName(std::string_view valueName)
+{
+    const auto opt = EnumInfo<Enum>::value(valueName);
+    if (opt.has_value())
+    {
+        std::cerr << "Value \"" << static_cast<std::underlying_type_t<Enum>>(*opt)
+                  << "\" found for unknown value name \"" << valueName << "\"" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+template<typename Enum, typename Fold = IgnoreCase>
+bool testValueByFoldedName(std::string_view valueName, std::optional<Enum> value)
+{
+    const auto opt = EnumInfo<Enum>::value(valueName, Fold());
+    if (opt != value)
+    {
+        std::cerr << "Value for name \"" << valueName << "\" is "
+                  << (opt.has_value() ? std::to_string(static_cast<std::underlying_type_t<Enum>>(*opt)) : "none")
+                  << " instead of "
+                  << (value.has_value() ? std::to_string(static_cast<std::underlying_type_t<Enum>>(*value)) : "none")
+                  << std::endl;
+        return false;
+    }
+    return EnumInfo<Enum>::index(valueName, Fold()).has_value() == value.has_value();
+}
+
+template<typename Enum>
+bool testValueNames(Enum value, const std::vector<std::string_view>& etalon)
+{
+    std::vector<std::string_view> names;
+    for (const auto name: EnumInfo<Enum>::valueNames(value))
+    {
+        names.push_back(name);
+    }
+    if (names != etalon || EnumInfo<Enum>::valueNames(value).size() != etalon.size())
+    {
+        std::cerr << "Value \"" << static_cast<std::underlying_type_t<Enum>>(value) << "\" has " << names.size()
+                  << " names instead of " << etalon.size() << std::endl;
+        return false;
+    }
+
+    for (auto it = EnumInfo<Enum>::valueNames(value).begin(); it != EnumInfo<Enum>::valueNames(value).end(); ++it)
+    {
+        const bool isCanonical = it == EnumInfo<Enum>::valueNames(value).begin();
+        if (EnumInfo<Enum>::isAlias(it.index()) == isCanonical
+            || EnumInfo<Enum>::canonicalIndex(it.index()) != EnumInfo<Enum>::index(value))
+        {
+            std::cerr << "Name \"" << *it << "\" is wrongly " << (isCanonical ? "alias" : "canonical") << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename Enum>
 bool testValueByIndex(size_t index, Enum value)
 {
@@ -234,6 +509,549 @@ bool testIndexByValueName(size_t index, std::string_view valueName)
     return isSame;
 }
 
+template<typename Enum>
+bool testWriteName(Enum value, std::string_view valueName)
+{
+    char buffer[16];
+    const auto size = EnumInfo<Enum>::writeName(value, buffer, sizeof(buffer));
+    std::string appended;
+    const bool isAppended = EnumInfo<Enum>::appendName(value, std::back_inserter(appended)).has_value();
+    const bool isSame = size.has_value()
+                        && std::string_view(buffer, *size) == valueName
+                        && isAppended
+                        && appended == valueName;
+    if (!isSame)
+    {
+        std::cerr << "Written name \"" << std::string_view(buffer, size.value_or(0))
+                  << "\" or appended name \"" << appended
+                  << "\" not equal to \"" << valueName << "\"" << std::endl;
+    }
+
+    return isSame;
+}
+
+bool testBatch()
+{
+    using SomeNamespace::Ports;
+    const Ports ports[] = {Ports::HTTP, Ports(81), Ports::SSH, Ports::HTTPS};
+    const std::string_view expectedNames[] = {"HTTP", "", "SecureShell", "HTTPS"};
+    std::string_view names[4];
+    const size_t unnamed = EnumInfo<Ports>::valueNames(ports, 4, names);
+
+    const std::string_view portNames[] = {"HTTPS", "FTP", "SSH", "", "HTTP"};
+    Ports values[5] = {};
+    uint64_t errorMask = 0;
+    const size_t unknown = EnumInfo<Ports>::values(portNames, 5, values, &errorMask);
+
+    const bool isOK = unnamed == 1
+                      && std::equal(names, names + 4, expectedNames)
+                      && unknown == 2
+                      && errorMask == 0b01010
+                      && values[0] == Ports::HTTPS
+                      && values[2] == Ports::SSH
+                      && values[4] == Ports::HTTP;
+    if (!isOK)
+    {
+        std::cerr << "Batch conversion failed: " << unnamed << " values without name, "
+                  << unknown << " unknown names, error mask " << errorMask << std::endl;
+    }
+
+    return isOK;
+}
+
+bool testEncoding()
+{
+    using Taste = SomeClass::TasteFlags;
+    using Info = EnumInfo<Taste>;
+    const Taste tastes[] = {Taste::Last, Taste(3), Taste::None, Taste::SourSweet};
+    Info::Code codes[4] = {};
+    uint64_t encodeMask = 0;
+    const size_t unnamed = Info::encode(tastes, 4, codes, &encodeMask);
+
+    const Info::Code received[] = {6, 7, 0, 255};
+    Taste decoded[4] = {};
+    uint64_t decodeMask = 0;
+    const size_t invalid = Info::decode(received, 4, decoded, &decodeMask);
+
+    const bool isOK = unnamed == 1
+                      && encodeMask == 0b0010
+                      && codes[0] == 6 && codes[2] == 0 && codes[3] == 4
+                      && invalid == 2
+                      && decodeMask == 0b1010
+                      && decoded[0] == Taste::Last && decoded[2] == Taste::None;
+    if (!isOK)
+    {
+        std::cerr << "Encoding failed: " << unnamed << " values without name, error mask " << encodeMask
+                  << ", " << invalid << " invalid codes, error mask " << decodeMask << std::endl;
+    }
+
+    return isOK;
+}
+
+bool testContainers()
+{
+    using SomeNamespace::Ports;
+    EnumMap<Ports, int> connections{{Ports::HTTP, 1}, {Ports::SSH, 2}};
+    connections[Ports::HTTPS] += 3;
+    std::vector<std::pair<Ports, int>> entries;
+    for (const auto [port, count]: connections)
+    {
+        entries.emplace_back(port, count);
+    }
+    bool isThrown = false;
+    try
+    {
+        connections.at(static_cast<Ports>(81));
+    }
+    catch (const std::out_of_range&)
+    {
+        isThrown = true;
+    }
+
+    using Taste = SomeClass::TasteFlags;
+    EnumSet<Taste> tastes{Taste::Sweet, Taste::Salted};
+    const bool isInserted = tastes.insert(Taste::Last) && !tastes.insert(Taste::Sweet) && !tastes.insert(Taste(3));
+    const bool isErased = tastes.erase(Taste::Salted) == 1 && tastes.erase(Taste::Salted) == 0;
+    std::vector<Taste> contained(tastes.begin(), tastes.end());
+    const EnumSet<Taste> sweet{Taste::Sweet, Taste::SourSweet};
+    const std::pair<Ports, int> expectedEntries[] = {{Ports::HTTP, 1}, {Ports::HTTPS, 3}, {Ports::SecureShell, 2}};
+    const Taste expectedContained[] = {Taste::Sweet, Taste::Last};
+    EnumSet<Ports> allPorts = EnumSet<Ports>::all();
+    const bool isAllDistinct = allPorts.size() == 3 && std::distance(allPorts.begin(), allPorts.end()) == 3
+                               && allPorts == EnumSet<Ports>{Ports::HTTP, Ports::HTTPS, Ports::SSH}
+                               && allPorts.erase(Ports::SSH) == 1 && !allPorts.contains(Ports::SecureShell)
+                               && allPorts.size() == 2 && std::distance(allPorts.begin(), allPorts.end()) == 2;
+
+    const bool isOK = std::equal(entries.begin(), entries.end(), std::begin(expectedEntries), std::end(expectedEntries))
+                      && connections[Ports::SecureShell] == 2
+                      && connections.find(static_cast<Ports>(81)) == nullptr
+                      && isThrown
+                      && isInserted && isErased
+                      && std::equal(contained.begin(), contained.end(), std::begin(expectedContained), std::end(expectedContained))
+                      && (tastes & sweet) == EnumSet<Taste>{Taste::Sweet}
+                      && (tastes | sweet).size() == 3
+                      && (tastes - sweet) != tastes
+                      && EnumSet<Taste>::all().size() == EnumInfo<Taste>::size()
+                      && isAllDistinct
+                      && !tastes.empty() && (tastes.clear(), tastes.empty());
+    if (!isOK)
+    {
+        std::cerr << "Containers failed: " << entries.size() << " map entries, " << contained.size() << " set values" << std::endl;
+    }
+
+    return isOK;
+}
+
+/// Handler specialized for each value, checked against the value it is called for
+template<typename Enum>
+struct CheckedHandler
+{
+    template<Enum Value>
+    size_t operator()(std::integral_constant<Enum, Value>) const
+    {
+        constexpr auto index = EnumInfo<Enum>::index(Value);
+        static_assert(index.has_value());
+        return *index;
+    }
+};
+
+template<typename Enum>
+bool testVisit(std::initializer_list<Enum> unnamed)
+{
+    bool isOK = true;
+    for (const auto entry: EnumInfo<Enum>())
+    {
+        const auto index = EnumInfo<Enum>::visit(entry.value(), CheckedHandler<Enum>());
+        if (index != EnumInfo<Enum>::index(entry.value()))
+        {
+            std::cerr << "Visit of " << entry.name() << " failed" << std::endl;
+            isOK = false;
+        }
+    }
+    for (const auto value: unnamed)
+    {
+        bool isCalled = EnumInfo<Enum>::visit(value, [](auto) {});
+        size_t otherwise = EnumInfo<Enum>::visit(value, CheckedHandler<Enum>(), [](Enum) { return size_t(-1); });
+        if (isCalled || otherwise != size_t(-1))
+        {
+            std::cerr << "Visit of unnamed value failed" << std::endl;
+            isOK = false;
+        }
+    }
+    return isOK;
+}
+
+bool testValidation()
+{
+    using SomeNamespace::Ports;
+    using Taste = SomeClass::TasteFlags;
+    const int ports[] = {80, 81, 22, 0, 443};
+    uint64_t portMask = 0;
+    const size_t invalidPorts = EnumInfo<Ports>::validate(ports, 5, &portMask);
+
+    std::array<int8_t, 100> suits{};
+    for (size_t i = 0; i < suits.size(); ++i)
+    {
+        suits[i] = static_cast<int8_t>(int(i % 6) - 1);
+    }
+    std::array<uint64_t, 2> suitMask{};
+    const size_t invalidSuits = EnumInfo<CardSuit>::validate(suits.data(), suits.size(), suitMask.data());
+    size_t marked = 0;
+    for (size_t i = 0; i < suits.size(); ++i)
+    {
+        const bool isMarked = (suitMask[i / 64] >> (i % 64) & 1) != 0;
+        marked += isMarked && !EnumInfo<CardSuit>::isValid(suits[i]) ? 1 : 0;
+    }
+
+    const bool isOK = invalidPorts == 2
+                      && portMask == 0b01010
+                      && invalidSuits == 33 && marked == invalidSuits
+                      && EnumInfo<Taste>::isValid(std::numeric_limits<uint64_t>::max())
+                      && !EnumInfo<Taste>::isValid(3)
+                      && EnumInfo<Taste>::valueOrNumber("18446744073709551615") == Taste::Last
+                      && !EnumInfo<Taste>::valueOrNumber("18446744073709551616").has_value()
+                      && EnumInfo<Ports>::valueOrNumber("22") == Ports::SSH
+                      && EnumInfo<Ports>::valueOrNumber("HTTP") == Ports::HTTP
+                      && !EnumInfo<Ports>::valueOrNumber("").has_value()
+                      && !EnumInfo<Ports>::valueOrNumber("80 ").has_value()
+                      && !EnumInfo<Ports>::valueOrNumber("+80").has_value();
+    if (!isOK)
+    {
+        std::cerr << "Validation failed: " << invalidPorts << " invalid ports, error mask " << portMask
+                  << ", " << invalidSuits << " invalid suits, " << marked << " marked" << std::endl;
+    }
+
+    return isOK;
+}
+
+/// Scans text split in two chunks at every position, matches must not depend on the split
+bool testScanner()
+{
+    using SomeNamespace::Ports;
+    using Match = EnumNameScanner<Ports>::Match;
+    constexpr std::string_view text = "HTTP HTTPS2 SSH,SecureShell;_HTTP\tHTTPS";
+    const Match expected[] = {{0, Ports::HTTP}, {12, Ports::SSH}, {16, Ports::SSH}, {34, Ports::HTTPS}};
+
+    bool isOK = true;
+    for (size_t split = 0; split <= text.size(); ++split)
+    {
+        std::array<Match, 8> found{};
+        size_t foundCount = 0;
+        const auto onMatch = [&](const Match& match)
+        {
+            found[foundCount++ % found.size()] = match;
+        };
+        auto scanner = EnumInfo<Ports>::scanner();
+        scanner.scan(text.substr(0, split), onMatch);
+        scanner.scan(text.substr(split), onMatch);
+        scanner.finish(onMatch);
+
+        bool isMatched = foundCount == std::size(expected);
+        for (size_t i = 0; isMatched && i < foundCount; ++i)
+        {
+            isMatched = found[i].offset == expected[i].offset && found[i].value == expected[i].value;
+        }
+        if (!isMatched)
+        {
+            std::cerr << "Scan split at " << split << " found " << foundCount << " names" << std::endl;
+            isOK = false;
+        }
+    }
+
+    // Long text, so that identifiers cross windows of the scanner, checked against a plain tokenizer
+    std::string longText;
+    for (size_t i = 0; i < 400; ++i)
+    {
+        longText += i % 3 == 0 ? "SSH" : i % 3 == 1 ? "HTTPS" : "Hearts";
+        longText += std::string(i % 7, i % 2 == 0 ? ' ' : ';');
+        longText += i % 50 == 0 ? std::string(70 + i % 3, 'x') + " " : "";
+    }
+    const auto identifierAt = [&longText](size_t offset)
+    {
+        size_t end = offset;
+        while (end < longText.size() && (std::isalnum(static_cast<unsigned char>(longText[end])) || longText[end] == '_'))
+        {
+            ++end;
+        }
+        return std::string_view(longText).substr(offset, end - offset);
+    };
+    size_t expectedCount = 0;
+    for (size_t i = 0; i < longText.size(); i += identifierAt(i).size() + 1)
+    {
+        expectedCount += EnumInfo<Ports>::index(identifierAt(i)).has_value() ? 1 : 0;
+    }
+    for (const size_t chunkSize: {1, 7, 64, 100, 5000})
+    {
+        size_t foundCount = 0;
+        const auto onMatch = [&](const Match& match)
+        {
+            const bool isAtBoundary = match.offset == 0 || longText[match.offset - 1] == ' ' || longText[match.offset - 1] == ';';
+            foundCount += isAtBoundary && EnumInfo<Ports>::value(identifierAt(match.offset)) == match.value ? 1 : 0;
+        };
+        auto scanner = EnumInfo<Ports>::scanner();
+        for (size_t offset = 0; offset < longText.size(); offset += chunkSize)
+        {
+            scanner.scan(std::string_view(longText).substr(offset, chunkSize), onMatch);
+        }
+        scanner.finish(onMatch);
+        if (foundCount != expectedCount)
+        {
+            std::cerr << "Scan in chunks of " << chunkSize << " found " << foundCount << " of " << expectedCount << " names" << std::endl;
+            isOK = false;
+        }
+    }
+
+    EnumMap<CardSuit, size_t> counts;
+    auto scanner = EnumInfo<CardSuit>::scanner();
+    scanner.count("Spades Hearts Spades", counts);
+    scanner.count("Spades", counts);
+    scanner.count("_Clubs ClubsDiamonds", counts);
+    scanner.finish(counts);
+
+    return isOK
+           && counts[CardSuit::Spades] == 1
+           && counts[CardSuit::Hearts] == 1
+           && counts[CardSuit::Diamonds] == 0
+           && counts[CardSuit::Clubs] == 0;
+}
+
+/// Parses every name split in two chunks at every position, ended by a delimiter or by finish()
+template<typename Enum>
+bool testParser(std::initializer_list<std::string_view> notNames)
+{
+    using Parser = typename EnumInfo<Enum>::Parser;
+    using Result = typename Parser::Result;
+
+    bool isOK = true;
+    for (const auto entry: EnumInfo<Enum>())
+    {
+        const std::string text = std::string(entry.name()) + " rest";
+        for (size_t split = 0; split <= entry.name().size(); ++split)
+        {
+            Parser parser;
+            std::string_view first = std::string_view(text).substr(0, split);
+            std::string_view second = std::string_view(text).substr(split);
+            const auto firstResult = parser.parse(first);
+            const auto secondResult = parser.parse(second);
+            Parser finished;
+            std::string_view whole = entry.name();
+            finished.parse(whole);
+            if (firstResult != Result::NeedMore || secondResult != Result::Match || parser.value() != entry.value()
+                || second != " rest" || finished.finish() != Result::Match || finished.value() != entry.value())
+            {
+                std::cerr << "Parse of " << entry.name() << " split at " << split << " failed" << std::endl;
+                isOK = false;
+            }
+        }
+    }
+    for (const auto notName: notNames)
+    {
+        Parser parser;
+        std::string_view input = notName;
+        const auto result = parser.parse(input);
+        if ((result == Result::NeedMore ? parser.finish() : result) != Result::NoMatch || parser.value().has_value())
+        {
+            std::cerr << "Parse of " << notName << " matched" << std::endl;
+            isOK = false;
+        }
+        parser.reset();
+        input = EnumInfo<Enum>::begin().name();
+        if (parser.parse(input) != Result::NeedMore || parser.finish() != Result::Match)
+        {
+            std::cerr << "Parse after reset failed" << std::endl;
+            isOK = false;
+        }
+    }
+    return isOK;
+}
+
+/// Looks up every value and name from several threads started at once
+template<typename Enum>
+bool testConcurrentLookup(size_t threadCount)
+{
+    std::atomic<bool> isStarted{false};
+    std::atomic<size_t> failures{0};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&isStarted, &failures]
+        {
+            while (!isStarted.load(std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+            for (size_t round = 0; round < 1000; ++round)
+            {
+                for (auto it: EnumInfo<Enum>())
+                {
+                    const auto name = EnumInfo<Enum>::valueName(it.value());
+                    const auto value = EnumInfo<Enum>::value(it.name());
+                    if (!name.has_value() || !value.has_value() || *value != it.value())
+                    {
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    }
+    isStarted.store(true, std::memory_order_release);
+    for (auto& thread: threads)
+    {
+        thread.join();
+    }
+
+    if (failures != 0)
+    {
+        std::cerr << failures << " failed concurrent lookups in enum " << EnumInfo<Enum>::name() << std::endl;
+    }
+
+    return failures == 0;
+}
+
+template<typename Enum>
+bool testFlagFormat(Enum value, std::optional<std::string_view> names)
+{
+    const auto string = FlagInfo<Enum>::toString(value);
+    const bool isSame = string.has_value() == names.has_value()
+                        && (!names.has_value() || *string == *names);
+    if (!isSame)
+    {
+        std::cerr << "Flags \"" << string.value_or("<none>")
+                  << "\" not equal to \"" << names.value_or("<none>") << "\" for value "
+                  << static_cast<std::underlying_type_t<Enum>>(value) << std::endl;
+    }
+
+    return isSame;
+}
+
+template<typename Enum>
+bool testFlagParse(std::string_view names, std::optional<Enum> value)
+{
+    const auto opt = FlagInfo<Enum>::parse(names);
+    const bool isSame = opt == value;
+    if (!isSame)
+    {
+        std::cerr << "Flags \"" << names << "\" parsed to "
+                  << (opt.has_value() ? std::to_string(*opt) : "<none>") << " instead of "
+                  << (value.has_value() ? std::to_string(*value) : "<none>") << std::endl;
+    }
+
+    return isSame;
+}
+
+template<typename Enum>
+bool testNoAllocation()
+{
+    const size_t allocationsBefore = allocationCount;
+    bool isOK = true;
+    for (auto it: EnumInfo<Enum>())
+    {
+        const auto name = EnumInfo<Enum>::valueName(it.value());
+        isOK = isOK
+               && name.has_value()
+               && EnumInfo<Enum>::value(*name).has_value()
+               && EnumInfo<Enum>::index(*name).has_value()
+               && EnumInfo<Enum, std::string>::value(*name).has_value()
+               && !EnumInfo<Enum>::valueNames(it.value()).empty()
+               && EnumInfo<Enum>::valueCaseInsensitive(*name).has_value()
+               && EnumInfo<Enum>::value(*name, IgnoreCaseAndSeparators()).has_value();
+
+        char buffer[64];
+        isOK = isOK
+               && EnumInfo<Enum>::writeName(it.value(), buffer, sizeof(buffer)) == name->size()
+               && FlagInfo<Enum>::format(it.value(), buffer, sizeof(buffer)).has_value();
+    }
+    const size_t allocations = allocationCount - allocationsBefore;
+    if (allocations != 0)
+    {
+        std::cerr << allocations << " heap allocations during lookup in enum "
+                  << EnumInfo<Enum>::name() << std::endl;
+        return false;
+    }
+    return isOK;
+}
+
+/// Reflection data besides name characters takes a fixed part and a few bytes per entry
+template<typename Enum>
+bool testDataSize(size_t fixedBytes, size_t bytesPerEntry)
+{
+    const size_t bytes = EnumInfo<Enum>::dataSize() - countNamesLength<Enum>();
+    return bytes <= fixedBytes + bytesPerEntry * EnumInfo<Enum>::size();
+}
+
+#if ENUM_INFO_REGISTRY
+bool testRegistry()
+{
+    const auto ports = EnumRegistry::find("SomeNamespace::Ports");
+    return true
+            && EnumRegistry::size() == 8
+            && ports != nullptr && ports->qualifiedName == "SomeNamespace::Ports" && ports->size == 4
+            && EnumRegistry::find("Ports") == nullptr
+            && EnumRegistry::find(EnumInfo<SomeNamespace::Ports>::typeHash()) == ports
+            && EnumRegistry::find(EnumInfo<CardSuit>::typeHash() + 1) == nullptr
+            && EnumRegistry::lookupValue("SomeNamespace::Ports", "SSH") == 22
+            && EnumRegistry::lookupValue(EnumInfo<SomeNamespace::Ports>::typeHash(), "SSH") == 22
+            && EnumRegistry::lookupValue("ns::Cs::Color", "Transparent") == -1
+            && EnumRegistry::lookupValue("SomeClass::TasteFlags", "Last") == int64_t(std::numeric_limits<uint64_t>::max())
+            && !EnumRegistry::lookupValue("SomeNamespace::Ports", "FTP").has_value()
+            && !EnumRegistry::lookupValue("SomeNamespace::Protocols", "SSH").has_value()
+            && EnumRegistry::lookupValueName("CardSuit", 2) == "Diamonds"
+            && EnumRegistry::lookupValueName(EnumInfo<Direction>::typeHash(), 0) == "Up"
+            && !EnumRegistry::lookupValueName("CardSuit", 4).has_value()
+            && !EnumRegistry::lookupValueName("CardSuit", 258).has_value()
+            ;
+}
+#endif
+
+#if ENUM_INFO_STATS
+bool testLookupStats()
+{
+    auto& stats = EnumInfo<Setting>::lookupStats();
+    stats.reset();
+
+    const bool isFound = EnumInfo<Setting>::value("Timeout").has_value()
+                         && !EnumInfo<Setting>::value("timeout").has_value()
+                         && EnumInfo<Setting, std::string>::valueName(size_t(1)).has_value()
+                         && !EnumInfo<Setting>::value(size_t(4)).has_value();
+
+    // Batch conversions aren't counted
+    const std::string_view names[] = {"Timeout", "timeout"};
+    Setting values[2] = {};
+    std::string_view valueNames[2];
+    EnumInfo<Setting>::Code codes[2];
+    const uint8_t underlying[] = {1, 9};
+    const bool isBatchConverted = EnumInfo<Setting>::values(names, 2, values) == 1
+                                  && EnumInfo<Setting>::valueNames(values, 2, valueNames) == 0
+                                  && EnumInfo<Setting>::encode(values, 2, codes) == 0
+                                  && EnumInfo<Setting>::validate(underlying, 2) == 1;
+
+    bool isRegistered = false;
+    for (auto registered = EnumLookupStats::first(); registered != nullptr; registered = registered->next())
+    {
+        isRegistered = isRegistered || registered == &stats;
+    }
+    std::ostringstream dump;
+    EnumLookupStats::dump(dump);
+
+    bool isOK = isFound && isRegistered && isBatchConverted
+                && stats.enumName() == "Setting"
+                && stats.calls(EnumLookup::ByName) == 2
+                && stats.misses(EnumLookup::ByName) == 1
+                && stats.calls(EnumLookup::ByIndex) == 2
+                && stats.misses(EnumLookup::ByIndex) == 1
+                && dump.str().find("Setting by index: 2 calls, 1 misses") != std::string::npos;
+#if ENUM_INFO_STATS_LATENCY
+    uint64_t measured = 0;
+    for (size_t bucket = 0; bucket < EnumLookupStats::latencyBucketCount; ++bucket)
+    {
+        measured += stats.latencies(EnumLookup::ByIndex, bucket);
+    }
+    isOK = isOK && measured == 2;
+#endif
+    return isOK;
+}
+#endif
+
 template<typename Enum>
 bool testIterator(std::vector<std::pair<Enum, std::string>> etalon)
 {
@@ -268,6 +1086,46 @@ bool testIterator(std::vector<std::pair<Enum, std::string>> etalon)
         }
         ++i;
     }
+
+    for (auto it = EnumInfo<Enum>::rbegin(); it != EnumInfo<Enum>::rend(); ++it)
+    {
+        --i;
+        const auto entry = *it;
+        const auto jumped = EnumInfo<Enum>::begin()[std::ptrdiff_t(i)];
+        if (entry.index() != i || entry.value() != etalon[i].first || entry.name() != etalon[i].second
+            || jumped != it.base() - 1 || EnumInfo<Enum>::end() - jumped != std::ptrdiff_t(etalon.size() - i))
+        {
+            std::cerr << "Reverse or random access mismatch at index " << i << std::endl;
+            return false;
+        }
+    }
+    return isOK && i == 0;
+}
+
+/// Standard algorithms over Color, which is declared in ascending value order
+bool testIteratorAlgorithms()
+{
+    using Info = EnumInfo<ns::Cs::Color>;
+    const auto byValue = [](Info::iterator entry, ns::Cs::Color value)
+    {
+        return entry.value() < value;
+    };
+    const auto green = std::lower_bound(Info::begin(), Info::end(), ns::Cs::Color::Green, byValue);
+    const auto absent = std::lower_bound(Info::begin(), Info::end(), static_cast<ns::Cs::Color>(0), byValue);
+    bool isOK = green != Info::end() && green.name() == "Green"
+                && absent.value() == ns::Cs::Color::Red
+                && std::distance(Info::begin(), Info::end()) == 4
+                && std::count_if(Info::rbegin(), Info::rend(), [](Info::iterator entry) { return entry.value() > 0; }) == 3;
+#if defined(__cpp_lib_ranges)
+    const auto names = Info() | std::views::reverse | std::views::transform([](auto entry) { return entry.name(); });
+    isOK = isOK && std::ranges::equal(names, std::array<std::string_view, 4>{"Blue", "Green", "Red", "Transparent"});
+#endif
+#if defined(__cpp_lib_parallel_algorithm)
+    std::array<std::string_view, 4> parallelNames;
+    std::transform(std::execution::par, Info::begin(), Info::end(), parallelNames.begin(), [](Info::iterator entry) { return entry.name(); });
+    isOK = isOK && std::count_if(std::execution::par, Info::begin(), Info::end(), [](Info::iterator entry) { return entry.value() > 0; }) == 3
+                && parallelNames == std::array<std::string_view, 4>{"Transparent", "Red", "Green", "Blue"};
+#endif
     return isOK;
 }
 
@@ -393,6 +1251,72 @@ int main()
                 ;
     });
 
+    test("Enum value by unknown value name", []
+    {
+        const std::string longName(40, 'S');
+        return true
+                && testNoValueByValueName<CardSuit>("")
+                && testNoValueByValueName<CardSuit>("Spade")
+                && testNoValueByValueName<CardSuit>("Spadess")
+                && testNoValueByValueName<CardSuit>(longName)
+                && testNoValueByValueName<SomeClass::TasteFlags>("SourSweetSour")
+                && testNoValueByValueName<SomeNamespace::Ports>("SecureSh")
+                && testNoValueByValueName<SomeNamespace::Ports>("SecureShellX")
+                && testNoValueByValueName<SomeNamespace::Ports>(std::string_view("SSH\0", 4))
+                ;
+    });
+
+    test("Enum value by case insensitive name", []
+    {
+        using SomeNamespace::Ports;
+        return true
+                && testValueByFoldedName<Ports>("https", Ports::HTTPS)
+                && testValueByFoldedName<Ports>("Https", Ports::HTTPS)
+                && testValueByFoldedName<Ports>("HTTPS", Ports::HTTPS)
+                && testValueByFoldedName<Ports>("secureSHELL", Ports::SecureShell)
+                && testValueByFoldedName<Ports>("secure_shell", std::nullopt)
+                && testValueByFoldedName<Ports>("http ", std::nullopt)
+                && testValueByFoldedName<Ports>("", std::nullopt)
+                && testValueByFoldedName<CardSuit>("SPADES", CardSuit::Spades)
+                && testValueByFoldedName<CardSuit>("spade", std::nullopt)
+                && testValueByFoldedName<ns::Cs::Color>("bLuE", ns::Cs::Color::Blue)
+                && testValueByFoldedName<SomeClass::TasteFlags>("soursweet", SomeClass::TasteFlags::SourSweet)
+                && testValueByFoldedName<Setting>("KEEPALIVE", Setting::KeepAlive)
+                && testValueByFoldedName<Setting>("Keep_Alive", Setting::keep_alive)
+                && EnumInfo<Ports>::valueCaseInsensitive("ssh") == Ports::SSH
+                ;
+    });
+
+    test("Enum value by normalized name", []
+    {
+        return true
+                && testValueByFoldedName<Setting, IgnoreCaseAndSeparators>("keep-alive", Setting::KeepAlive)
+                && testValueByFoldedName<Setting, IgnoreCaseAndSeparators>("keep_alive", Setting::KeepAlive)
+                && testValueByFoldedName<Setting, IgnoreCaseAndSeparators>("MAX_CONNECTIONS", Setting::MaxConnections)
+                && testValueByFoldedName<Setting, IgnoreCaseAndSeparators>("max-connections", Setting::MaxConnections)
+                && testValueByFoldedName<Setting, IgnoreCaseAndSeparators>("time_out", Setting::Timeout)
+                && testValueByFoldedName<Setting, IgnoreCaseAndSeparators>("_-_", std::nullopt)
+                && testValueByFoldedName<Setting, IgnoreCaseAndSeparators>("max connections", std::nullopt)
+                && testValueByFoldedName<SomeNamespace::Ports, IgnoreCaseAndSeparators>("Secure-Shell", SomeNamespace::Ports::SecureShell)
+                ;
+    });
+
+    test("Enum value names with aliases", []
+    {
+        using SomeNamespace::Ports;
+        return true
+                && testValueNames(Ports::SSH, {"SecureShell", "SSH"})
+                && testValueNames(Ports::HTTPS, {"HTTPS"})
+                && testValueNames(static_cast<Ports>(21), {})
+                && testValueNames(Direction::Up, {"Up", "Default"})
+                && testValueNames(Direction::Down, {"Down"})
+                && testValueNames(SomeClass::TasteFlags::SourSweet, {"SourSweet"})
+                && testValueNames(ns::Cs::Color::Transparent, {"Transparent"})
+                && !EnumInfo<Ports>::isAlias(EnumInfo<Ports>::size())
+                && !EnumInfo<Ports>::canonicalIndex(EnumInfo<Ports>::size()).has_value()
+                ;
+    });
+
     test("Enum value by index", []
     {
         return true
@@ -502,4 +1426,201 @@ int main()
                                                })
                 ;
     });
+
+    test("Enum iterator algorithms", []
+    {
+        return testIteratorAlgorithms();
+    });
+
+    test("Enum write name", []
+    {
+        char buffer[8];
+        return true
+                && testWriteName(CardSuit::Diamonds, "Diamonds")
+                && testWriteName(SomeClass::TasteFlags::Last, "Last")
+                && testWriteName(SomeNamespace::Ports::SSH, "SecureShell")
+                && testWriteName(ns::Cs::Color::Transparent, "Transparent")
+                && !EnumInfo<ns::Cs::Color>::writeName(ns::Cs::Color::Transparent, buffer, sizeof(buffer))
+                && !EnumInfo<CardSuit>::writeName(CardSuit(9), buffer, sizeof(buffer))
+                && !EnumInfo<CardSuit>::appendName(CardSuit(9), buffer)
+                ;
+    });
+
+#if defined(__cpp_lib_format)
+    test("Enum std::format", []
+    {
+        return true
+                && std::format("{}", CardSuit::Hearts) == "Hearts"
+                && std::format("{}", ns::Cs::Color(-5)) == "-5"
+                && std::format("[{:>8}]", CardSuit::Clubs) == "[   Clubs]"
+                && std::format("[{:^7}]", CardSuit(7)) == "[   7   ]"
+                ;
+    });
+#endif
+
+#if defined(FMT_VERSION)
+    test("Enum fmt::format", []
+    {
+        return true
+                && fmt::format("{}", CardSuit::Hearts) == "Hearts"
+                && fmt::format("{}", ns::Cs::Color(-5)) == "-5"
+                && fmt::format("[{:>8}]", CardSuit::Clubs) == "[   Clubs]"
+                && fmt::format("[{:^7}]", CardSuit(7)) == "[   7   ]"
+                ;
+    });
+#endif
+
+    test("Enum batch conversion", []
+    {
+        return testBatch();
+    });
+
+    test("Enum binary encoding", []
+    {
+        return testEncoding();
+    });
+
+    test("Enum validation", []
+    {
+        return testValidation();
+    });
+
+    test("Enum visit", []
+    {
+        return true
+                && testVisit<CardSuit>({static_cast<CardSuit>(-1), static_cast<CardSuit>(4)})
+                && testVisit<SomeClass::TasteFlags>({static_cast<SomeClass::TasteFlags>(3), static_cast<SomeClass::TasteFlags>(101)})
+                && testVisit<SomeNamespace::Ports>({static_cast<SomeNamespace::Ports>(0), static_cast<SomeNamespace::Ports>(81)})
+                && testVisit<ns::Cs::Color>({static_cast<ns::Cs::Color>(0), static_cast<ns::Cs::Color>(-2)})
+                && testVisit<Direction>({static_cast<Direction>(2), static_cast<Direction>(255)});
+    });
+
+    test("Enum name parser", []
+    {
+        return true
+                && testParser<CardSuit>({"", " Spades", "Spade", "Spadess", "Joker"})
+                && testParser<SomeNamespace::Ports>({"HTT", "HTTPX", "SSh", "SecureShell_2", "443"})
+                && testParser<Setting>({"keep", "KeepAlive_", "keep-alive", "Timeouts"});
+    });
+
+    test("Enum name scanner", []
+    {
+        return testScanner();
+    });
+
+    test("Enum containers", []
+    {
+        return testContainers();
+    });
+
+    test("Enum concurrent lookup", []
+    {
+        constexpr size_t threadCount = 8;
+        return true
+                && testConcurrentLookup<CardSuit>(threadCount)
+                && testConcurrentLookup<SomeClass::TasteFlags>(threadCount)
+                && testConcurrentLookup<SomeNamespace::Ports>(threadCount)
+                && testConcurrentLookup<ns::Cs::Color>(threadCount)
+                // Not used at run time before
+                && testConcurrentLookup<Direction>(threadCount)
+                ;
+    });
+
+    test("Flags format", []
+    {
+        using Taste = SomeClass::TasteFlags;
+        char buffer[12];
+        return true
+                && FlagInfo<Taste>::format(Taste(Taste::Salted | Taste::Sweet), buffer, sizeof(buffer)) == 12u
+                && !FlagInfo<Taste>::format(Taste(Taste::Salted | Taste::Sweet), buffer, sizeof(buffer) - 1)
+                && testFlagFormat(Taste::None, "None")
+                && testFlagFormat(Taste::Sour, "Sour")
+                && testFlagFormat(Taste(Taste::Salted | Taste::Sweet), "Salted|Sweet")
+                && testFlagFormat(Taste(Taste::Sour | Taste::Sweet), "SourSweet")
+                && testFlagFormat(Taste(Taste::Salted | Taste::Sour | Taste::Sweet), "SourSweet|Salted")
+                && testFlagFormat(Taste(Taste::Other | Taste::Salted), "Other|Salted")
+                && testFlagFormat(Taste::Last, "Last")
+                && testFlagFormat(Taste(8), std::nullopt)
+                && testFlagFormat(CardSuit(0), "Spades")
+                // No name for 0 to parse back
+                && testFlagFormat(ns::Cs::Color(0), std::nullopt)
+                && testFlagFormat(ns::Cs::Color::Blue, "Blue")
+                ;
+    });
+
+    test("Flags parse", []
+    {
+        using Taste = SomeClass::TasteFlags;
+        return true
+                && testFlagParse("None", std::optional(Taste::None))
+                && testFlagParse("Salted|Sweet", std::optional(Taste(Taste::Salted | Taste::Sweet)))
+                && testFlagParse(" Sweet | Salted ", std::optional(Taste(Taste::Salted | Taste::Sweet)))
+                && testFlagParse("SourSweet|Salted", std::optional(Taste(Taste::Salted | Taste::Sour | Taste::Sweet)))
+                && testFlagParse<Taste>("Salted|Bitter", std::nullopt)
+                && testFlagParse<Taste>("Salted|", std::nullopt)
+                && testFlagParse<Taste>("", std::nullopt)
+                && testFlagParse<ns::Cs::Color>("", std::nullopt)
+                ;
+    });
+
+#if ENUM_INFO_SCAN
+    test("Enum scanned without ENUM_DECLARE", []
+    {
+        using third_party::Level;
+        using State = third_party::Widget::State;
+        return true
+                && testName<Level>("Level")
+                && testSize<Level>(4)
+                && testValueNameByValue(Level::Error, "Error")
+                && testValueNameByValue(Level::Debug, "Debug")
+                && testValueNameByIndex<Level>(1, "Warning")
+                && testValueByValueName(Level::Info, "Info")
+                && testNoValueByValueName<Level>("Trace")
+                && testIndexByValue(3, Level::Debug)
+                && !EnumInfo<Level>::valueName(static_cast<Level>(3)).has_value()
+                && testValueNameByValue(State::Shown, "Shown")
+                && testValueNameByValue(State::Disabled, "Disabled")
+                && testIndexByValueName<State>(0, "Hidden")
+                && testVisit<State>({static_cast<State>(1)})
+                && testParser<Level>({"Err", "error", "Debug2"})
+                ;
+    });
+#endif
+
+    test("Enum data size", []
+    {
+        return true
+                && testDataSize<CardSuit>(384, 16)
+                && testDataSize<SomeClass::TasteFlags>(384, 16)
+                && testDataSize<SomeNamespace::Ports>(384, 16)
+                && testDataSize<ns::Cs::Color>(384, 16)
+                ;
+    });
+
+#if ENUM_INFO_REGISTRY
+    test("Enum registry", []
+    {
+        return testRegistry();
+    });
+#endif
+
+#if ENUM_INFO_STATS
+    test("Lookup statistics", []
+    {
+        return testLookupStats();
+    });
+#endif
+
+    test("Lookup without heap allocation", []
+    {
+        return true
+                && testNoAllocation<CardSuit>()
+                && testNoAllocation<SomeClass::TasteFlags>()
+                && testNoAllocation<SomeNamespace::Ports>()
+                && testNoAllocation<ns::Cs::Color>()
+                && testNoAllocation<Setting>()
+                ;
+    });
+
+    return failedTestCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 }